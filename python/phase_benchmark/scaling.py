@@ -0,0 +1,63 @@
+import os
+import json
+import math
+import shutil
+import argparse
+import subprocess
+import tempfile
+
+# Weak/strong scaling driver for phase-2d-unstructured-scaling. Each run copies the case into a scratch directory,
+# runs a fixed number of time steps and the per-run json files are collected into a single report.
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('CASE', type=str, help='example directory containing a "case" sub-directory, eg Examples/LidDrivenCavity')
+    parser.add_argument('--mode', type=str, choices=['weak', 'strong'], default='strong')
+    parser.add_argument('--procs', type=int, nargs='+', default=[1, 2, 4, 8])
+    parser.add_argument('--nx', type=int, default=128, help='cells in x (strong) or cells in x per process (weak)')
+    parser.add_argument('--ny', type=int, default=128, help='cells in y (strong) or cells in y per process (weak)')
+    parser.add_argument('--steps', type=int, default=10)
+    parser.add_argument('--mpirun', type=str, default='mpirun')
+    parser.add_argument('--exe', type=str, default='phase-2d-unstructured-scaling')
+    parser.add_argument('--output', type=str, default='scaling.json')
+
+    args = parser.parse_args()
+
+    runs = []
+
+    for nProcs in args.procs:
+        if args.mode == 'weak':
+            # Keep the cells per process fixed by growing the grid by sqrt(nProcs) in each direction
+            factor = math.sqrt(nProcs)
+            nx, ny = int(round(args.nx * factor)), int(round(args.ny * factor))
+        else:
+            nx, ny = args.nx, args.ny
+
+        run_dir = tempfile.mkdtemp(prefix='phase_scaling_')
+        shutil.copytree(os.path.join(args.CASE, 'case'), os.path.join(run_dir, 'case'))
+
+        cmd = [args.mpirun, '-np', str(nProcs), args.exe,
+               '--nx', str(nx), '--ny', str(ny), '--steps', str(args.steps), '--output', 'scaling.json']
+
+        print('Running {} on {} processes with a {}x{} grid...'.format(args.CASE, nProcs, nx, ny))
+        subprocess.check_call(cmd, cwd=run_dir, stdout=subprocess.DEVNULL)
+
+        with open(os.path.join(run_dir, 'scaling.json')) as f:
+            runs.append(json.load(f))
+
+        shutil.rmtree(run_dir)
+
+    base = runs[0]['totalTime'] * runs[0]['nProcs']
+
+    for run in runs:
+        if args.mode == 'weak':
+            run['efficiency'] = runs[0]['totalTime'] / run['totalTime']
+        else:
+            run['efficiency'] = base / (run['totalTime'] * run['nProcs'])
+
+    with open(args.output, 'w') as f:
+        json.dump({'case': args.CASE, 'mode': args.mode, 'runs': runs}, f, indent=2)
+
+    for run in runs:
+        print('{:>6d} procs {:>10d} cells {:>10.3f} s efficiency {:.2f}'.format(
+            run['nProcs'], run['nCells'], run['totalTime'], run['efficiency']))
@@ -75,11 +75,6 @@ protected:
 
     //- Previous Fields
     std::vector<std::pair<Scalar, std::shared_ptr<Field<T>>>> _prevFields;
-
-    //- Misc buffers for parallel comms
-    std::vector<std::vector<T>> _sendBuffers;
-
-    std::vector<std::vector<T>> _recvBuffers;
 };
 
 #include "Field.tpp"
@@ -16,9 +16,6 @@ Field<T>::Field(const std::string &name,
 
     if(faceField)
         _faceData.resize(_grid->faces().size());
-
-    _recvBuffers.resize(_grid->comm().nProcs());
-    _sendBuffers.resize(_grid->comm().nProcs());
 }
 
 template<class T>
@@ -67,27 +64,8 @@ void Field<T>::savePreviousSolution(Scalar timeStep, int nSolutions)
 template<class T>
 void Field<T>::sendMessages(bool sync)
 {
-    //- Post non-blocking comms
-    for(int proc = 0; proc < _grid->comm().nProcs(); ++proc)
-    {
-        //- Post the recv
-        auto &recvBuffer = _recvBuffers[proc];
-        recvBuffer.resize(_grid->recvBuffer(proc).size());
-
-        _grid->comm().irecv(proc, recvBuffer, proc);
-
-        //- Post the send
-        auto &sendBuffer = _sendBuffers[proc];
-        sendBuffer.resize(_grid->sendBuffer(proc).size());
-
-        std::transform(_grid->sendBuffer(proc).begin(),
-                       _grid->sendBuffer(proc).end(),
-                       sendBuffer.begin(),
-                       [this](const Cell &cell) { return _cellData[cell.lid()]; });
-
-        _grid->comm().isend(proc, sendBuffer, _grid->comm().rank());
-    }
-
-    if(sync)
-        _grid->comm().waitAll();
+    //- Buffer cells are exchanged in place with the subarray datatypes of the decomposition, the exchange always
+    //- completes before returning
+    if(_grid->decomposition())
+        _grid->decomposition()->exchange(_cellData);
 }
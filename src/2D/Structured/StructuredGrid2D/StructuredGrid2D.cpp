@@ -81,57 +81,38 @@ void StructuredGrid2D::init(Size nCellsI, Size nCellsJ, std::pair<Scalar, Scalar
 
 void StructuredGrid2D::init(Size nCellsI, Size nCellsJ, Scalar lx, Scalar ly, int nbuff)
 {
-    auto dim = computeBlockDims(false);
+    //- The local grid is the owned block padded with nbuff buffer cells on each side shared with another rank, the
+    //- same layout as the decomposition arrays
+    auto decomp = std::make_shared<CartesianDecomposition>(*_comm, nCellsI, nCellsJ, 1, nbuff);
+    _decomp = decomp;
 
-    _comm->printf("Grid partitioning dimensions (%d,%d).\n", (int)dim[0], (int)dim[1]);
+    _comm->printf("Grid partitioning dimensions (%d,%d).\n",
+                  decomp->dims(CartesianDecomposition::I), decomp->dims(CartesianDecomposition::J));
 
-    std::vector<int> ownership(nCellsI * nCellsJ);
-    std::array<Size, 2> irange = {0, 0}, jrange = {0, 0};
-    std::array<Size, 2> irangeLocal = {0, 0}, jrangeLocal = {0, 0};
-
-    Size qi = nCellsI / dim[0];
-    Size ri = nCellsI % dim[0];
-    Size qj = nCellsJ / dim[1];
-    Size rj = nCellsJ % dim[1];
-
-    for(auto blockJ = 0, proc = 0; blockJ < dim[1]; ++blockJ)
-        for(auto blockI = 0; blockI < dim[0]; ++blockI, ++proc)
-        {
-            irange[0] = blockI * qi + std::min(ri, (Size)blockI);
-            irange[1] = irange[0] + qi + (ri > blockI ? 1 : 0);
-            jrange[0] = blockJ * qj + std::min(rj, (Size)blockJ);
-            jrange[1] = jrange[0] + qj + (rj > blockJ ? 1 : 0);
-
-            for(auto j = jrange[0]; j < jrange[1]; ++j)
-                for(auto i = irange[0]; i < irange[1]; ++i)
-                    ownership[j * nCellsI + i] = proc;
-
-            if(proc == _comm->rank())
-            {
-                irangeLocal[0] = std::max((int)irange[0] - nbuff, 0);
-                irangeLocal[1] = std::min((int)irange[1] + nbuff, (int)nCellsI);
-                jrangeLocal[0] = std::max((int)jrange[0] - nbuff, 0);
-                jrangeLocal[1] = std::min((int)jrange[1] + nbuff, (int)nCellsJ);
-            }
-        }
+    Index i0 = decomp->begin(CartesianDecomposition::I) - decomp->nGhost(CartesianDecomposition::I_NEG);
+    Index j0 = decomp->begin(CartesianDecomposition::J) - decomp->nGhost(CartesianDecomposition::J_NEG);
+    Index ni = decomp->arrayExtent(CartesianDecomposition::I);
+    Index nj = decomp->arrayExtent(CartesianDecomposition::J);
 
     std::vector<int> localOwnership;
     std::vector<Label> localGlobalIds;
 
-    for(auto j = jrangeLocal[0]; j < jrangeLocal[1]; ++j)
-        for(auto i = irangeLocal[0]; i < irangeLocal[1]; ++i)
+    for(Index j = j0; j < j0 + nj; ++j)
+        for(Index i = i0; i < i0 + ni; ++i)
         {
             localGlobalIds.emplace_back(j * nCellsI + i);
-            localOwnership.emplace_back(ownership[localGlobalIds.back()]);
+            localOwnership.emplace_back(decomp->owner(i - decomp->begin(CartesianDecomposition::I),
+                                                      j - decomp->begin(CartesianDecomposition::J),
+                                                      0));
         }
 
     Scalar dx = lx / nCellsI;
     Scalar dy = ly / nCellsJ;
 
-    auto xb = std::make_pair(dx * irangeLocal[0], dx * irangeLocal[1]);
-    auto yb = std::make_pair(dy * jrangeLocal[0], dy * jrangeLocal[1]);
+    auto xb = std::make_pair(dx * i0, dx * (i0 + ni));
+    auto yb = std::make_pair(dy * j0, dy * (j0 + nj));
 
-    init(irangeLocal[1] - irangeLocal[0], jrangeLocal[1] - jrangeLocal[0], xb, yb);
+    init(ni, nj, xb, yb);
     initParallel(localOwnership, localGlobalIds);
 }
 
@@ -195,39 +176,6 @@ Size StructuredGrid2D::maxInc(const Cell &cell, Coordinates::Direction dir) cons
     }
 }
 
-std::array<Size, 2> StructuredGrid2D::computeBlockDims(bool stripPartitioning) const
-{
-    if(stripPartitioning)
-        return std::array<Size, 2>({(Size)_comm->nProcs(), 1});
-
-    Size i = 2, num = _comm->nProcs();
-
-    std::deque<Size> factors(1, 1);
-
-    while(i <= num)
-    {
-        if(num % i)
-            ++i;
-        else
-        {
-            factors.emplace_front(i);
-            num /= i;
-        }
-    }
-
-    while(factors.size() > 2)
-    {
-        std::sort(factors.begin(), factors.end());
-        factors[1] *= factors[0];
-        factors.pop_front();
-    }
-
-    std::array<Size, 2> result;
-    result[0] = factors[0];
-    result[1] = factors[1];
-    return result;
-}
-
 void StructuredGrid2D::initParallel(const std::vector<int> &ownership, const std::vector<Label> &gids)
 {
     if(ownership.size() != _cells.size() || gids.size() != _cells.size())
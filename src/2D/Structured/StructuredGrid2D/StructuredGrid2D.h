@@ -5,6 +5,7 @@
 
 #include "System/Input.h"
 #include "System/Communicator.h"
+#include "System/CartesianDecomposition.h"
 
 #include "Cell.h"
 #include "Face.h"
@@ -90,6 +91,10 @@ public:
     const Communicator &comm() const
     { return *_comm; }
 
+    //- Block decomposition of the global grid, null for grids built from explicit bounds
+    const std::shared_ptr<const CartesianDecomposition> &decomposition() const
+    { return _decomp; }
+
     const std::vector<int> &ownership() const
     { return _ownership; }
 
@@ -101,8 +106,6 @@ public:
 
 protected:
 
-    std::array<Size, 2> computeBlockDims(bool stripPartitioning) const;
-
     void initParallel(const std::vector<int> &ownership, const std::vector<Label> &gids);
 
     //- Mesh parameters
@@ -120,6 +123,8 @@ protected:
     //- Parallel
     std::shared_ptr<const Communicator> _comm;
 
+    std::shared_ptr<const CartesianDecomposition> _decomp;
+
     std::vector<int> _ownership;
 
     std::unordered_map<Label, Label> _globalToLocalIdMap;
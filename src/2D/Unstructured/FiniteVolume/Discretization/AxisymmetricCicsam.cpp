@@ -3,15 +3,43 @@
 #include "Cicsam.h"
 #include "AxisymmetricCicsam.h"
 
+std::vector<Scalar> axi::cicsam::cellCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep)
+{
+    std::vector<Scalar> co(u.grid()->cells().size(), 0.);
+    const GridGeometry &geom = u.grid()->geometry();
+
+    for (const Face &face: u.grid()->interiorFaces())
+    {
+        Scalar flux = dot(u(face), geom.polarSf(face)) * timeStep;
+
+        if (flux > 0.)
+            co[face.lCell().id()] += flux;
+        else
+            co[face.rCell().id()] -= flux;
+    }
+
+    for (const Face &face: u.grid()->boundaryFaces())
+        co[face.lCell().id()] += std::max(dot(u(face), geom.polarSf(face)) * timeStep, 0.);
+
+    for (const Cell &cell: u.grid()->cells())
+        co[cell.id()] /= geom.polarVolume(cell);
+
+    return co;
+}
+
 std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u, const ScalarFiniteVolumeField &gamma, const VectorFiniteVolumeField &gradGamma, Scalar timeStep)
 {
     const Scalar k = 1;
 
+    const std::vector<Scalar> co = cellCourantNumbers(u, timeStep);
+    const std::vector<Vector2D> unitGradGamma = ::cicsam::unitGradients(gradGamma);
+
     std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
+    const GridGeometry &geom = gamma.grid()->geometry();
 
     for (const Face &face: gamma.grid()->interiorFaces())
     {
-        Vector2D sf = face.polarOutwardNorm(face.lCell().centroid());
+        Vector2D sf = geom.polarSf(face);
         Scalar flux = dot(u(face), sf);
 
         const Cell &d = flux > 0. ? face.lCell() : face.rCell();
@@ -30,15 +58,11 @@ std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolu
         if(std::isnan(gammaDTilde))
             gammaDTilde = 0.;
 
-        Scalar coD = 0.; //- Cell courant number
-        for (const InteriorLink &nb: d.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.polarOutwardNorm()) / d.polarVolume() * timeStep, 0.);
-
-        for (const BoundaryLink &bd: d.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.polarOutwardNorm()) / d.polarVolume() * timeStep, 0.);
+        Scalar coD = co[d.id()];
 
-        Scalar thetaF = std::acos(std::abs(dot(gradGamma(d).unitVec(), rc.unitVec())));
-        Scalar psiF = std::min(k * (std::cos(2 * thetaF) + 1.) / 2., 1.);
+        //- (cos(2 thetaF) + 1) / 2 = cos^2(thetaF)
+        Scalar cosThetaF = dot(unitGradGamma[d.id()], rc) / rc.mag();
+        Scalar psiF = std::min(k * cosThetaF * cosThetaF, 1.);
         Scalar gammaFTilde = psiF * ::cicsam::hc(gammaDTilde, coD) + (1. - psiF) * ::cicsam::uq(gammaDTilde, coD);
         Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
 
@@ -55,6 +79,7 @@ std::vector<Scalar> axi::cicsam::faceInterpolationWeights(const VectorFiniteVolu
 FiniteVolumeEquation<Scalar> axi::cicsam::div(const VectorFiniteVolumeField &u, ScalarFiniteVolumeField &gamma, const std::vector<Scalar> &faceInterpolationWeights, Scalar theta, const CellGroup &cells)
 {
     FiniteVolumeEquation<Scalar> eqn(gamma, 5);
+    const GridGeometry &geom = gamma.grid()->geometry();
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
 
     for(const Cell &cell: gamma.cells())
@@ -63,7 +88,7 @@ FiniteVolumeEquation<Scalar> axi::cicsam::div(const VectorFiniteVolumeField &u,
         {
             Scalar b = faceInterpolationWeights[nb.face().id()];
 
-            Scalar flux = dot(u(nb.face()), nb.polarOutwardNorm());
+            Scalar flux = dot(u(nb.face()), geom.polarSf(nb));
 
             const Cell &d = flux > 0. ? cell : nb.cell();
             const Cell &a = flux <= 0. ? cell : nb.cell();
@@ -75,7 +100,7 @@ FiniteVolumeEquation<Scalar> axi::cicsam::div(const VectorFiniteVolumeField &u,
 
         for(const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar flux = dot(u(bd.face()), bd.polarOutwardNorm());
+            Scalar flux = dot(u(bd.face()), geom.polarSf(bd.face()));
 
             switch(gamma.boundaryType(bd.face()))
             {
@@ -102,9 +127,11 @@ void axi::cicsam::computeMomentumFlux(Scalar rho1,
                                       const std::vector<Scalar> &faceInterpolationWeights,
                                       VectorFiniteVolumeField &rhoU)
 {
+    const GridGeometry &geom = rhoU.grid()->geometry();
+
     for(const Face &f: rhoU.grid()->interiorFaces())
     {
-        Scalar flux = dot(u(f), f.polarOutwardNorm(f.lCell().centroid()));
+        Scalar flux = dot(u(f), geom.polarSf(f));
 
         const Cell &d = flux > 0. ? f.lCell() : f.rCell();
         const Cell &a = flux <= 0. ? f.lCell() : f.rCell();
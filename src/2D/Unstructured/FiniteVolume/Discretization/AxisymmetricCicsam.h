@@ -8,6 +8,9 @@ namespace axi
 namespace cicsam
 {
 
+//- Courant numbers of all cells indexed by cell id, based on the polar face norms and cell volumes
+std::vector<Scalar> cellCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep);
+
 std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                              const ScalarFiniteVolumeField &gamma,
                                              const VectorFiniteVolumeField &gradGamma,
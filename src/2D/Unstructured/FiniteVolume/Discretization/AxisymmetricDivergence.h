@@ -11,6 +11,7 @@ FiniteVolumeEquation<T> div(const VectorFiniteVolumeField &u,
                             Scalar theta = 1.)
 {
     FiniteVolumeEquation<T> eqn(phi);
+    const GridGeometry &geom = phi.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
     const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
@@ -18,7 +19,7 @@ FiniteVolumeEquation<T> div(const VectorFiniteVolumeField &u,
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
+            Vector2D sf = geom.polarSf(nb);
 
             Scalar flux = dot(u(nb.face()), sf);
             Scalar flux0 = dot(u0(nb.face()), sf);
@@ -31,7 +32,7 @@ FiniteVolumeEquation<T> div(const VectorFiniteVolumeField &u,
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
+            Vector2D sf = geom.polarSf(bd.face());
             Scalar flux = dot(u(bd.face()), sf);
             Scalar flux0 = dot(u0(bd.face()), sf);
 
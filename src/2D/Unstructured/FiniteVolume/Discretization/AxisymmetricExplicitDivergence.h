@@ -11,6 +11,7 @@ FiniteVolumeEquation<T> dive(const VectorFiniteVolumeField &u,
                              Scalar theta = 1.)
 {
     FiniteVolumeEquation<T> eqn(phi, 0);
+    const GridGeometry &geom = phi.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
     const VectorFiniteVolumeField &u1 = u.oldField(1);
 
@@ -21,7 +22,7 @@ FiniteVolumeEquation<T> dive(const VectorFiniteVolumeField &u,
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
+            Vector2D sf = geom.polarSf(nb);
 
             Scalar flux0 = dot(u0(nb.face()), sf);
             Scalar flux1 = dot(u1(nb.face()), sf);
@@ -35,7 +36,7 @@ FiniteVolumeEquation<T> dive(const VectorFiniteVolumeField &u,
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
+            Vector2D sf = geom.polarSf(bd.face());
             Scalar flux0 = dot(u0(bd.face()), sf);
             Scalar flux1 = dot(u1(bd.face()), sf);
 
@@ -4,21 +4,20 @@ FiniteVolumeEquation<Scalar> axi::laplacian(Scalar gamma,
                                             ScalarFiniteVolumeField &phi)
 {
     FiniteVolumeEquation<Scalar> eqn(phi);
+    const GridGeometry &geom = phi.grid()->geometry();
 
     for (const Cell &cell: phi.cells())
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = gamma * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = gamma * geom.polarLaplacianWeight(nb.face());
             eqn.add(cell, cell, -flux);
             eqn.add(cell, nb.cell(), flux);
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-            Scalar flux = gamma * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = gamma * geom.polarLaplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -43,21 +42,20 @@ FiniteVolumeEquation<Scalar> axi::laplacian(Scalar gamma,
 FiniteVolumeEquation<Scalar> axi::laplacian(const ScalarFiniteVolumeField &gamma, ScalarFiniteVolumeField &phi)
 {
     FiniteVolumeEquation<Scalar> eqn(phi, 5);
+    const GridGeometry &geom = phi.grid()->geometry();
 
     for (const Cell &cell: phi.cells())
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = gamma(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = gamma(nb.face()) * geom.polarLaplacianWeight(nb.face());
             eqn.add(cell, cell, -flux);
             eqn.add(cell, nb.cell(), flux);
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-            Scalar flux = gamma(bd.face()) * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = gamma(bd.face()) * geom.polarLaplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -84,14 +82,14 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(Scalar gamma,
                                               Scalar theta)
 {
     FiniteVolumeEquation<Vector2D> eqn(u);
+    const GridGeometry &geom = u.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
     for (const Cell &cell: u.cells())
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = gamma * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = gamma * geom.polarLaplacianWeight(nb.face());
 
             eqn.add(cell, cell, -theta * flux);
             eqn.add(cell, nb.cell(), theta * flux);
@@ -100,9 +98,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(Scalar gamma,
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-
-            Scalar flux = gamma * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = gamma * geom.polarLaplacianWeight(bd.face());
 
             switch (u.boundaryType(bd.face()))
             {
@@ -116,7 +112,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(Scalar gamma,
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, -theta * flux);
                 eqn.add(cell, cell, theta * flux * outer(tw, tw));
@@ -143,6 +139,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(const ScalarFiniteVolumeField &gam
                                               Scalar theta)
 {
     FiniteVolumeEquation<Vector2D> eqn(u);
+    const GridGeometry &geom = u.grid()->geometry();
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
@@ -150,9 +147,8 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(const ScalarFiniteVolumeField &gam
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = gamma(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
-            Scalar flux0 = gamma0(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = gamma(nb.face()) * geom.polarLaplacianWeight(nb.face());
+            Scalar flux0 = gamma0(nb.face()) * geom.polarLaplacianWeight(nb.face());
 
             eqn.add(cell, cell, -theta * flux);
             eqn.add(cell, nb.cell(), theta * flux);
@@ -161,10 +157,8 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(const ScalarFiniteVolumeField &gam
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-
-            Scalar flux = gamma(bd.face()) * dot(bd.rf(), sf) / bd.rf().magSqr();
-            Scalar flux0 = gamma0(bd.face()) * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = gamma(bd.face()) * geom.polarLaplacianWeight(bd.face());
+            Scalar flux0 = gamma0(bd.face()) * geom.polarLaplacianWeight(bd.face());
 
             switch (u.boundaryType(bd.face()))
             {
@@ -178,7 +172,7 @@ FiniteVolumeEquation<Vector2D> axi::laplacian(const ScalarFiniteVolumeField &gam
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, -theta * flux);
                 eqn.add(cell, cell, theta * flux * outer(tw, tw));
@@ -3,9 +3,10 @@
 Vector axi::src::src(const ScalarFiniteVolumeField &phi)
 {
     Vector phiSrc(phi.grid()->localCells().size());
+    const GridGeometry &geom = phi.grid()->geometry();
 
     for (const Cell &cell: phi.cells())
-        phiSrc(phi.indexMap()->local(cell, 0)) = phi(cell) * cell.polarVolume();
+        phiSrc(phi.indexMap()->local(cell, 0)) = phi(cell) * geom.polarVolume(cell);
 
     return phiSrc;
 }
@@ -13,10 +14,11 @@ Vector axi::src::src(const ScalarFiniteVolumeField &phi)
 Vector axi::src::src(const VectorFiniteVolumeField &u)
 {
     Vector divU(2 * u.grid()->localCells().size());
+    const GridGeometry &geom = u.grid()->geometry();
 
     for (const Cell &cell: u.cells())
     {
-        Vector2D tmp = u(cell) * cell.polarVolume();
+        Vector2D tmp = u(cell) * geom.polarVolume(cell);
         divU(u.indexMap()->local(cell, 0)) = tmp.x;
         divU(u.indexMap()->local(cell, 1)) = tmp.y;
     }
@@ -27,15 +29,16 @@ Vector axi::src::src(const VectorFiniteVolumeField &u)
 Vector axi::src::div(const VectorFiniteVolumeField &u)
 {
     Vector divU(u.grid()->localCells().size());
+    const GridGeometry &geom = u.grid()->geometry();
 
     for (const Cell &cell: u.cells())
     {
         Scalar tmp = 0.;
         for (const InteriorLink &nb: cell.neighbours())
-            tmp += dot(u(nb.face()), nb.polarOutwardNorm());
+            tmp += dot(u(nb.face()), geom.polarSf(nb));
 
         for (const BoundaryLink &bd: cell.boundaries())
-            tmp += dot(u(bd.face()), bd.polarOutwardNorm());
+            tmp += dot(u(bd.face()), geom.polarSf(bd.face()));
 
         divU(u.indexMap()->local(cell, 0)) = tmp;
     }
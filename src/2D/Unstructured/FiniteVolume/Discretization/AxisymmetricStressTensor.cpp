@@ -3,24 +3,23 @@
 VectorFvmEquation axi::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, VectorFiniteVolumeField &u, Scalar theta)
 {
     FiniteVolumeEquation<Vector2D> eqn(u, 5);
+    const GridGeometry &geom = u.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
     for (const Cell &cell: u.cells())
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = mu * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = mu * geom.polarLaplacianWeight(nb.face());
 
             eqn.add(cell, cell, -theta * flux);
             eqn.add(cell, nb.cell(), theta * flux);
-            eqn.addSource(cell, -p(nb.face()) * sf + (1. - theta) * flux * (u0(nb.cell()) - u0(cell)));
+            eqn.addSource(cell, -p(nb.face()) * geom.polarSf(nb) + (1. - theta) * flux * (u0(nb.cell()) - u0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-            Scalar flux = mu * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = mu * geom.polarLaplacianWeight(bd.face());
 
             switch (u.boundaryType(bd.face()))
             {
@@ -34,7 +33,7 @@ VectorFvmEquation axi::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vec
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, -theta * flux);
                 eqn.add(cell, cell, theta * flux * outer(tw, tw));
@@ -46,7 +45,7 @@ VectorFvmEquation axi::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vec
                 throw Exception("axi", "divSigma", "unrecognized or unspecified boundary type.");
             }
 
-            eqn.addSource(cell, -p(bd.face()) * sf);
+            eqn.addSource(cell, -p(bd.face()) * geom.polarSf(bd.face()));
         }
 
         //- Non-polar volume since we just want the rz face
@@ -61,6 +60,7 @@ VectorFvmEquation axi::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vec
 VectorFvmEquation axi::divSigma(const ScalarFiniteVolumeField &rho, const ScalarFiniteVolumeField &mu, const ScalarFiniteVolumeField &p, VectorFiniteVolumeField &u, Scalar theta)
 {
     FiniteVolumeEquation<Vector2D> eqn(u, 5);
+    const GridGeometry &geom = u.grid()->geometry();
     const ScalarFiniteVolumeField &mu0 = mu.oldField(0);
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
@@ -68,20 +68,18 @@ VectorFvmEquation axi::divSigma(const ScalarFiniteVolumeField &rho, const Scalar
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm();
-            Scalar flux = mu(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
-            Scalar flux0 = mu0(nb.face()) * dot(nb.rc(), sf) / nb.rc().magSqr();
+            Scalar flux = mu(nb.face()) * geom.polarLaplacianWeight(nb.face());
+            Scalar flux0 = mu0(nb.face()) * geom.polarLaplacianWeight(nb.face());
 
             eqn.add(cell, cell, -theta * flux);
             eqn.add(cell, nb.cell(), theta * flux);
-            eqn.addSource(cell, -p(nb.face()) * sf * rho(cell) / rho(nb.face()) + (1. - theta) * flux0 * (u0(nb.cell()) - u0(cell)));
+            eqn.addSource(cell, -p(nb.face()) * geom.polarSf(nb) * rho(cell) / rho(nb.face()) + (1. - theta) * flux0 * (u0(nb.cell()) - u0(cell)));
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm();
-            Scalar flux = mu(bd.face()) * dot(bd.rf(), sf) / bd.rf().magSqr();
-            Scalar flux0 = mu0(bd.face()) * dot(bd.rf(), sf) / bd.rf().magSqr();
+            Scalar flux = mu(bd.face()) * geom.polarLaplacianWeight(bd.face());
+            Scalar flux0 = mu0(bd.face()) * geom.polarLaplacianWeight(bd.face());
 
             switch (u.boundaryType(bd.face()))
             {
@@ -95,7 +93,7 @@ VectorFvmEquation axi::divSigma(const ScalarFiniteVolumeField &rho, const Scalar
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, -theta * flux);
                 eqn.add(cell, cell, theta * flux * outer(tw, tw));
@@ -107,7 +105,7 @@ VectorFvmEquation axi::divSigma(const ScalarFiniteVolumeField &rho, const Scalar
                 throw Exception("axi", "divSigma", "unrecognized or unspecified boundary type.");
             }
 
-            eqn.addSource(cell, -p(bd.face()) * sf * rho(cell) / rho(bd.face()));
+            eqn.addSource(cell, -p(bd.face()) * geom.polarSf(bd.face()) * rho(cell) / rho(bd.face()));
         }
 
         //- Non-polar volume since we just want the rz face
@@ -9,11 +9,12 @@ namespace axi
     FiniteVolumeEquation<T> ddt(FiniteVolumeField<T> &phi, Scalar timeStep)
     {
         FiniteVolumeEquation<T> eqn(phi);
+        const GridGeometry &geom = phi.grid()->geometry();
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
         for (const Cell &cell: phi.cells())
         {
-            Scalar volume = cell.polarVolume();
+            Scalar volume = geom.polarVolume(cell);
             eqn.add(cell, cell, volume / timeStep);
             eqn.addSource(cell, -phi0(cell) * volume / timeStep);
         }
@@ -25,12 +26,13 @@ namespace axi
     FiniteVolumeEquation<T> ddt(const ScalarFiniteVolumeField &rho, FiniteVolumeField<T> &phi, Scalar timeStep)
     {
         FiniteVolumeEquation<T> eqn(phi);
+        const GridGeometry &geom = phi.grid()->geometry();
         const ScalarFiniteVolumeField &rho0 = rho.oldField(0);
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
         for (const Cell &cell: phi.cells())
         {
-            Scalar volume = cell.polarVolume();
+            Scalar volume = geom.polarVolume(cell);
             eqn.add(cell, cell, rho(cell) * volume / timeStep);
             eqn.addSource(cell, -rho0(cell) * phi0(cell) * volume / timeStep);
         }
@@ -14,18 +14,62 @@ Scalar cicsam::uq(Scalar gammaDTilde, Scalar coD)
                 gammaDTilde;
 }
 
+std::vector<Scalar> cicsam::cellCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep)
+{
+    std::vector<Scalar> co(u.grid()->cells().size(), 0.);
+    const GridGeometry &geom = u.grid()->geometry();
+
+    for (const Face &face: u.grid()->interiorFaces())
+    {
+        Scalar flux = dot(u(face), geom.sf(face)) * timeStep;
+
+        if (flux > 0.)
+            co[face.lCell().id()] += flux;
+        else
+            co[face.rCell().id()] -= flux;
+    }
+
+    for (const Face &face: u.grid()->boundaryFaces())
+        co[face.lCell().id()] += std::max(dot(u(face), geom.sf(face)) * timeStep, 0.);
+
+    for (const Cell &cell: u.grid()->cells())
+        co[cell.id()] /= cell.volume();
+
+    return co;
+}
+
+std::vector<Vector2D> cicsam::unitGradients(const VectorFiniteVolumeField &gradGamma)
+{
+    std::vector<Vector2D> n(gradGamma.grid()->cells().size());
+
+    for (const Cell &cell: gradGamma.grid()->cells())
+        n[cell.id()] = gradGamma(cell).unitVec();
+
+    return n;
+}
+
 std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                                      const ScalarFiniteVolumeField &gamma,
                                                      const VectorFiniteVolumeField &gradGamma,
                                                      Scalar timeStep)
+{
+    return faceInterpolationWeights(u, gamma, gradGamma, unitGradients(gradGamma), cellCourantNumbers(u, timeStep));
+}
+
+std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                                     const ScalarFiniteVolumeField &gamma,
+                                                     const VectorFiniteVolumeField &gradGamma,
+                                                     const std::vector<Vector2D> &unitGradGamma,
+                                                     const std::vector<Scalar> &co)
 {
     const Scalar k = 1;
 
     std::vector<Scalar> beta(gamma.grid()->faces().size(), 0.);
+    const GridGeometry &geom = gamma.grid()->geometry();
 
     for (const Face &face: gamma.grid()->interiorFaces())
     {
-        Vector2D sf = face.outwardNorm(face.lCell().centroid());
+        Vector2D sf = geom.sf(face);
         Scalar flux = dot(u(face), sf);
         const Cell &donor = flux > 0. ? face.lCell() : face.rCell();
         const Cell &acceptor = flux <= 0. ? face.lCell() : face.rCell();
@@ -40,15 +84,11 @@ std::vector<Scalar> cicsam::faceInterpolationWeights(const VectorFiniteVolumeFie
         if(std::isnan(gammaDTilde))
             gammaDTilde = 0.;
 
-        Scalar coD = 0.; //- Cell courant number
-        for (const InteriorLink &nb: donor.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.outwardNorm()) / donor.volume() * timeStep, 0.);
+        Scalar coD = co[donor.id()];
 
-        for (const BoundaryLink &bd: donor.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.outwardNorm()) / donor.volume() * timeStep, 0.);
-
-        Scalar thetaF = std::acos(std::abs(dot(gradGamma(donor).unitVec(), rc.unitVec())));
-        Scalar psiF = std::min(k * (std::cos(2 * thetaF) + 1.) / 2., 1.);
+        //- (cos(2 thetaF) + 1) / 2 = cos^2(thetaF), where thetaF is the angle between the interface normal and rc
+        Scalar cosThetaF = dot(unitGradGamma[donor.id()], rc) / rc.mag();
+        Scalar psiF = std::min(k * cosThetaF * cosThetaF, 1.);
         Scalar gammaFTilde = psiF * hc(gammaDTilde, coD) + (1. - psiF) * uq(gammaDTilde, coD);
         Scalar betaFace = (gammaFTilde - gammaDTilde) / (1. - gammaDTilde);
 
@@ -144,3 +184,115 @@ FiniteVolumeEquation<Scalar> cicsam::div(const VectorFiniteVolumeField &u,
 {
     return div(u, gamma, faceInterpolationWeights, theta, gamma.cells());
 }
+
+void cicsam::advect(const VectorFiniteVolumeField &u,
+                    ScalarFiniteVolumeField &gamma,
+                    std::vector<Scalar> &faceInterpolationWeights,
+                    Scalar timeStep,
+                    const CellGroup &cells)
+{
+    const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
+    const GridGeometry &geom = gamma.grid()->geometry();
+    const Size nCells = gamma.grid()->cells().size();
+
+    //- Upwind fluxes, bounds of the neighbourhoods and the high order corrections entering and leaving each cell
+    std::vector<Scalar> net(nCells, 0.), gammaMin(nCells), gammaMax(nCells), pPlus(nCells, 0.), pMinus(nCells, 0.);
+
+    for (const Cell &cell: gamma.grid()->cells())
+        gammaMin[cell.id()] = gammaMax[cell.id()] = gamma0(cell);
+
+    for (const Face &face: gamma.grid()->interiorFaces())
+    {
+        const Cell &l = face.lCell(), &r = face.rCell();
+        Scalar flux = dot(u(face), geom.sf(face)) * timeStep;
+        const Cell &donor = flux > 0. ? l : r;
+        const Cell &acceptor = flux <= 0. ? l : r;
+
+        Scalar fluxL = flux * gamma0(donor);
+        Scalar fluxA = flux * faceInterpolationWeights[face.id()] * (gamma0(acceptor) - gamma0(donor));
+
+        net[l.id()] += fluxL;
+        net[r.id()] -= fluxL;
+
+        gammaMin[l.id()] = std::min(gammaMin[l.id()], gamma0(r));
+        gammaMax[l.id()] = std::max(gammaMax[l.id()], gamma0(r));
+        gammaMin[r.id()] = std::min(gammaMin[r.id()], gamma0(l));
+        gammaMax[r.id()] = std::max(gammaMax[r.id()], gamma0(l));
+
+        if (fluxA > 0.)
+        {
+            pMinus[l.id()] += fluxA;
+            pPlus[r.id()] += fluxA;
+        }
+        else
+        {
+            pPlus[l.id()] -= fluxA;
+            pMinus[r.id()] -= fluxA;
+        }
+    }
+
+    for (const Face &face: gamma.grid()->boundaryFaces())
+    {
+        const Cell &cell = face.lCell();
+        Scalar flux = dot(u(face), geom.sf(face)) * timeStep;
+
+        switch (gamma.boundaryType(face))
+        {
+        case ScalarFiniteVolumeField::FIXED:
+            net[cell.id()] += flux * gamma0(face);
+            gammaMin[cell.id()] = std::min(gammaMin[cell.id()], gamma0(face));
+            gammaMax[cell.id()] = std::max(gammaMax[cell.id()], gamma0(face));
+            break;
+
+        case ScalarFiniteVolumeField::NORMAL_GRADIENT:
+            net[cell.id()] += flux * gamma0(cell);
+            break;
+
+        case ScalarFiniteVolumeField::SYMMETRY:
+            break;
+
+        default:
+            throw Exception("cicsam", "advect", "unrecognized or unspecified boundary type.");
+        }
+    }
+
+    //- Fractions of the incoming and outgoing corrections each cell can take, stored as two sets for communication
+    std::vector<Scalar> fractions(2 * nCells, 1.);
+
+    for (const Cell &cell: cells)
+    {
+        Scalar gammaL = gamma0(cell) - net[cell.id()] / cell.volume();
+        Scalar qPlus = std::max(std::min(gammaMax[cell.id()], 1.) - gammaL, 0.) * cell.volume();
+        Scalar qMinus = std::max(gammaL - std::max(gammaMin[cell.id()], 0.), 0.) * cell.volume();
+
+        if (pPlus[cell.id()] > qPlus)
+            fractions[cell.id()] = qPlus / pPlus[cell.id()];
+
+        if (pMinus[cell.id()] > qMinus)
+            fractions[cell.id() + nCells] = qMinus / pMinus[cell.id()];
+    }
+
+    gamma.grid()->sendMessages(fractions, 2);
+
+    //- Limit the corrections, net now accumulates the bounded fluxes
+    for (const Face &face: gamma.grid()->interiorFaces())
+    {
+        const Cell &l = face.lCell(), &r = face.rCell();
+        Scalar flux = dot(u(face), geom.sf(face)) * timeStep;
+        const Cell &donor = flux > 0. ? l : r;
+        const Cell &acceptor = flux <= 0. ? l : r;
+        Scalar &b = faceInterpolationWeights[face.id()];
+
+        Scalar fluxA = flux * b * (gamma0(acceptor) - gamma0(donor));
+        Scalar lambda = fluxA > 0. ?
+                    std::min(fractions[l.id() + nCells], fractions[r.id()]) :
+                    std::min(fractions[l.id()], fractions[r.id() + nCells]);
+
+        b *= lambda;
+        net[l.id()] += lambda * fluxA;
+        net[r.id()] -= lambda * fluxA;
+    }
+
+    for (const Cell &cell: cells)
+        gamma(cell) = gamma0(cell) - net[cell.id()] / cell.volume();
+}
@@ -9,11 +9,24 @@ Scalar hc(Scalar gammaDTilde, Scalar coD);
 
 Scalar uq(Scalar gammaDTilde, Scalar coD);
 
+//- Courant numbers of all cells indexed by cell id, computed from the outflow of each face flux
+std::vector<Scalar> cellCourantNumbers(const VectorFiniteVolumeField &u, Scalar timeStep);
+
+//- Unit interface normals of all cells indexed by cell id
+std::vector<Vector2D> unitGradients(const VectorFiniteVolumeField &gradGamma);
+
 std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
                                              const ScalarFiniteVolumeField &gamma,
                                              const VectorFiniteVolumeField &gradGamma,
                                              Scalar timeStep);
 
+//- Face kernel, for precomputed cell courant numbers and unit interface normals
+std::vector<Scalar> faceInterpolationWeights(const VectorFiniteVolumeField &u,
+                                             const ScalarFiniteVolumeField &gamma,
+                                             const VectorFiniteVolumeField &gradGamma,
+                                             const std::vector<Vector2D> &unitGradGamma,
+                                             const std::vector<Scalar> &co);
+
 void computeMomentumFlux(Scalar rho1,
                          Scalar rho2,
                          const VectorFiniteVolumeField &u,
@@ -27,6 +40,15 @@ FiniteVolumeEquation<Scalar> div(const VectorFiniteVolumeField &u,
                                  Scalar theta,
                                  const CellGroup &cells);
 
+//- Explicit update of gamma from its old field, without a linear solve. The high order part of the CICSAM fluxes is
+//- limited (FCT) so that every cell stays within the bounds of its old neighbourhood, which requires a cell courant
+//- number below one. The weights are replaced by the limited weights actually used
+void advect(const VectorFiniteVolumeField &u,
+            ScalarFiniteVolumeField &gamma,
+            std::vector<Scalar> &faceInterpolationWeights,
+            Scalar timeStep,
+            const CellGroup &cells);
+
 FiniteVolumeEquation<Scalar> div(const VectorFiniteVolumeField &u,
                                  ScalarFiniteVolumeField &gamma,
                                  const std::vector<Scalar> &faceInterpolationWeights,
@@ -4,26 +4,31 @@ FiniteVolumeEquation<Vector2D> fv::div(const VectorFiniteVolumeField &phiU,
                                        const JacobianField &gradU,
                                        VectorFiniteVolumeField &u)
 {
-    FiniteVolumeEquation<Vector2D> eqn(u);
+    FiniteVolumeEquation<Vector2D> eqn(u, fv::faceLoopNnz(*u.grid()));
+    const GridGeometry &geom = u.grid()->geometry();
 
-    for (const Cell &cell: u.cells())
+    fv::forEachInteriorFace(*u.grid(), u.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
+        //- The upwind cell and its deferred correction are the same for both sides of the face
+        Scalar flux = dot(phiU(face), geom.sf(face));
+        const Cell &upCell = flux > 0. ? face.lCell() : face.rCell();
+        Vector2D correction = flux * dot(gradU(upCell), face.centroid() - upCell.centroid());
+
+        if (lIn)
         {
-            Scalar flux = dot(phiU(nb.face()), nb.outwardNorm());
+            eqn.add(face.lCell(), upCell, flux);
+            eqn.addSource(face.lCell(), correction);
+        }
 
-            if (flux > 0.)
-            {
-                eqn.add(cell, cell, flux);
-                eqn.addSource(cell, flux * dot(gradU(cell), nb.rFaceVec()));
-            }
-            else
-            {
-                eqn.add(cell, nb.cell(), flux);
-                eqn.addSource(cell, flux * dot(gradU(nb.cell()), nb.face().centroid() - nb.cell().centroid()));
-            }
+        if (rIn)
+        {
+            eqn.add(face.rCell(), upCell, -flux);
+            eqn.addSource(face.rCell(), -correction);
         }
+    });
 
+    for (const Cell &cell: u.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
             Scalar flux = dot(phiU(bd.face()), bd.outwardNorm());
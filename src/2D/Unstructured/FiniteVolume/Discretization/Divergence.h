@@ -4,6 +4,8 @@
 #include "FiniteVolume/Equation/FiniteVolumeEquation.h"
 #include "FiniteVolume/Field/JacobianField.h"
 
+#include "FaceLoop.h"
+
 namespace fv
 {
     template<typename T>
@@ -11,24 +13,39 @@ namespace fv
                     FiniteVolumeField<T> &phi,
                     Scalar theta = 1.)
     {
-        FiniteVolumeEquation<T> eqn(phi);
+        FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+        const GridGeometry &geom = phi.grid()->geometry();
 
         const VectorFiniteVolumeField &u0 = u.oldField(0);
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-        for (const Cell &cell: phi.cells())
+        forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
         {
-            for (const InteriorLink &nb: cell.neighbours())
+            const Cell &lCell = face.lCell(), &rCell = face.rCell();
+
+            //- Fluxes out of lCell
+            Scalar flux = dot(u(face), geom.sf(face));
+            Scalar flux0 = dot(u0(face), geom.sf(face));
+
+            if (lIn)
             {
-                Scalar flux = dot(u(nb.face()), nb.outwardNorm());
-                Scalar flux0 = dot(u0(nb.face()), nb.outwardNorm());
+                eqn.add(lCell, lCell, theta * std::max(flux, 0.));
+                eqn.add(lCell, rCell, theta * std::min(flux, 0.));
+                eqn.addSource(lCell, (1. - theta) * std::max(flux0, 0.) * phi0(lCell));
+                eqn.addSource(lCell, (1. - theta) * std::min(flux0, 0.) * phi0(rCell));
+            }
 
-                eqn.add(cell, cell, theta * std::max(flux, 0.));
-                eqn.add(cell, nb.cell(), theta * std::min(flux, 0.));
-                eqn.addSource(cell, (1. - theta) * std::max(flux0, 0.) * phi0(cell));
-                eqn.addSource(cell, (1. - theta) * std::min(flux0, 0.) * phi0(nb.cell()));
+            if (rIn)
+            {
+                eqn.add(rCell, rCell, theta * std::max(-flux, 0.));
+                eqn.add(rCell, lCell, theta * std::min(-flux, 0.));
+                eqn.addSource(rCell, (1. - theta) * std::max(-flux0, 0.) * phi0(rCell));
+                eqn.addSource(rCell, (1. - theta) * std::min(-flux0, 0.) * phi0(lCell));
             }
+        });
 
+        for (const Cell &cell: phi.cells())
+        {
             for (const BoundaryLink &bd: cell.boundaries())
             {
                 Scalar flux = dot(u(bd.face()), bd.outwardNorm());
@@ -63,26 +80,40 @@ namespace fv
                      FiniteVolumeField<T> &phi,
                      Scalar theta = 1.)
     {
-        FiniteVolumeEquation<T> eqn(phi);
+        FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+        const GridGeometry &geom = phi.grid()->geometry();
         const VectorFiniteVolumeField &u0 = u.oldField(0);
         const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-        for (const Cell &cell: phi.cells())
+        forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
         {
-            for (const InteriorLink &nb: cell.neighbours())
-            {
-                Scalar flux = theta * dot(u(nb.face()), nb.outwardNorm());
-                Scalar flux0 = (1. - theta) * dot(u0(nb.face()), nb.outwardNorm());
+            const Cell &lCell = face.lCell(), &rCell = face.rCell();
+
+            //- Fluxes out of lCell
+            Scalar flux = theta * dot(u(face), geom.sf(face));
+            Scalar flux0 = (1. - theta) * dot(u0(face), geom.sf(face));
 
-                Scalar lc = (nb.face().centroid() - cell.centroid()).mag();
-                Scalar ln = (nb.face().centroid() - nb.cell().centroid()).mag();
-                Scalar g = ln / (lc + ln);
+            Scalar ll = (face.centroid() - lCell.centroid()).mag();
+            Scalar lr = (face.centroid() - rCell.centroid()).mag();
+            Scalar g = lr / (ll + lr);
+
+            if (lIn)
+            {
+                eqn.add(lCell, lCell, g * flux);
+                eqn.add(lCell, rCell, (1. - g) * flux);
+                eqn.addSource(lCell, flux0 * (g * phi0(lCell) + (1. - g) * phi0(rCell)));
+            }
 
-                eqn.add(cell, cell, g * flux);
-                eqn.add(cell, nb.cell(), (1. - g) * flux);
-                eqn.addSource(cell, flux0 * (g * phi0(cell) + (1. - g) * phi0(nb.cell())));
+            if (rIn)
+            {
+                eqn.add(rCell, rCell, (1. - g) * -flux);
+                eqn.add(rCell, lCell, g * -flux);
+                eqn.addSource(rCell, -flux0 * ((1. - g) * phi0(rCell) + g * phi0(lCell)));
             }
+        });
 
+        for (const Cell &cell: phi.cells())
+        {
             for (const BoundaryLink &bd: cell.boundaries())
             {
                 Scalar flux = theta * dot(u(bd.face()), bd.outwardNorm());
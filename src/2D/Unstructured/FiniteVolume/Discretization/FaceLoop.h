@@ -0,0 +1,63 @@
+#ifndef PHASE_FACE_LOOP_H
+#define PHASE_FACE_LOOP_H
+
+#include "FiniteVolume/Equation/FiniteVolumeEquation.h"
+
+namespace fv
+{
+    //- Calls f(face, lIn, rIn) once for each interior face adjacent to a cell of the group, lIn and rIn telling which
+    //- of the two cells are in the group. A face on a partition boundary only contributes to the local cell, the other
+    //- side is assembled by the process that owns it. Faces of one colour share no cells, so their contributions to
+    //- the rows of the two cells are scattered concurrently
+    template<class FaceFunc>
+    void forEachInteriorFace(const FiniteVolumeGrid2D &grid, const CellGroup &cells, const FaceFunc &f)
+    {
+        for (const std::vector<Ref<const Face>> &colour: grid.interiorFaceColours())
+        {
+#pragma omp parallel for
+            for (long i = 0; i < (long) colour.size(); ++i)
+            {
+                const Face &face = colour[i];
+                bool lIn = cells.isInSet(face.lCell()), rIn = cells.isInSet(face.rCell());
+
+                if (lIn || rIn)
+                    f(face, lIn, rIn);
+            }
+        }
+    }
+
+    //- Row capacity of equations assembled over faces, so that the sparse structure never has to grow while the rows
+    //- are filled concurrently
+    inline int faceLoopNnz(const FiniteVolumeGrid2D &grid)
+    { return grid.maxCellNeighbours() + 1; }
+
+    //- coeff * (phi(rCell) - phi(lCell)) added implicitly to the row of lCell, and its negative to the row of rCell
+    template<class T>
+    void addFaceDifference(FiniteVolumeEquation<T> &eqn, const Face &face, bool lIn, bool rIn, Scalar coeff)
+    {
+        if (lIn)
+        {
+            eqn.add(face.lCell(), face.rCell(), coeff);
+            eqn.add(face.lCell(), face.lCell(), -coeff);
+        }
+
+        if (rIn)
+        {
+            eqn.add(face.rCell(), face.lCell(), coeff);
+            eqn.add(face.rCell(), face.rCell(), -coeff);
+        }
+    }
+
+    //- Explicit face value added to the source of lCell, and its negative to the source of rCell
+    template<class T, class T2>
+    void addFaceSource(FiniteVolumeEquation<T> &eqn, const Face &face, bool lIn, bool rIn, const T2 &val)
+    {
+        if (lIn)
+            eqn.addSource(face.lCell(), val);
+
+        if (rIn)
+            eqn.addSource(face.rCell(), -val);
+    }
+}
+
+#endif
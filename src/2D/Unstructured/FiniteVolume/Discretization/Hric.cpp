@@ -8,10 +8,14 @@ ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
                                    Scalar timeStep)
 {
     ScalarFiniteVolumeField beta(gamma.grid(), "beta");
+    const GridGeometry &geom = gamma.grid()->geometry();
+
+    const std::vector<Scalar> co = cicsam::cellCourantNumbers(u, timeStep);
+    const std::vector<Vector2D> unitGradGamma = cicsam::unitGradients(gradGamma);
 
     for(const Face& face: gamma.grid()->interiorFaces())
     {
-        Vector2D sf = face.outwardNorm(face.lCell().centroid());
+        Vector2D sf = geom.sf(face);
         Scalar flux = dot(u(face), sf);
         const Cell& donor = flux >= 0. ? face.lCell() : face.rCell();
         const Cell& acceptor = flux >= 0. ? face.rCell() : face.lCell();
@@ -22,17 +26,12 @@ ScalarFiniteVolumeField hric::beta(const VectorFiniteVolumeField &u,
         Scalar gammaU = clamp(gammaA - 2.*dot(rc, gradGamma(donor)), 0., 1.);
         Scalar gammaDTilde = (gammaD - gammaU) / (gammaA - gammaU);
 
-        Scalar coD = 0.; //- Cell courant number
-        for(const InteriorLink& nb: donor.neighbours())
-            coD += std::max(dot(u(nb.face()), nb.outwardNorm()) / donor.volume() * timeStep, 0.);
-
-        for(const BoundaryLink& bd: donor.boundaries())
-            coD += std::max(dot(u(bd.face()), bd.outwardNorm()) / donor.volume() * timeStep, 0.);
+        Scalar coD = co[donor.id()];
 
         Scalar gammaFTilde = gammaDTilde < 0. || gammaDTilde > 1. ? gammaDTilde:
                              0. <= gammaDTilde && gammaDTilde < 0.5 ? 2. * gammaDTilde: 1.;
 
-        Scalar lambdaF = std::sqrt(std::abs(dot(gradGamma(donor).unitVec(), rc.unitVec())));
+        Scalar lambdaF = std::sqrt(std::abs(dot(unitGradGamma[donor.id()], rc)) / rc.mag());
 
         gammaFTilde = lambdaF * gammaFTilde + (1. - lambdaF) * gammaDTilde;
         gammaFTilde = coD < 0.3 ? gammaFTilde:
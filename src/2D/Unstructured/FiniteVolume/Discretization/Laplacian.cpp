@@ -6,22 +6,22 @@ namespace fv
 template<>
 FiniteVolumeEquation<Vector2D> laplacian(Scalar gamma, VectorFiniteVolumeField &phi, Scalar theta)
 {
-    FiniteVolumeEquation<Vector2D> eqn(phi);
+    FiniteVolumeEquation<Vector2D> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
     const VectorFiniteVolumeField &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.add(cell, cell, theta * -coeff);
-            eqn.addSource(cell, (1. - theta) * coeff * (phi0(nb.cell()) - phi0(cell)));
-        }
+        Scalar coeff = gamma * geom.laplacianWeight(face);
+        addFaceDifference(eqn, face, lIn, rIn, theta * coeff);
+        addFaceSource(eqn, face, lIn, rIn, (1. - theta) * coeff * (phi0(face.rCell()) - phi0(face.lCell())));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -35,7 +35,7 @@ FiniteVolumeEquation<Vector2D> laplacian(Scalar gamma, VectorFiniteVolumeField &
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, theta * -coeff);
                 eqn.add(cell, cell, theta * coeff * outer(tw, tw));
@@ -45,7 +45,7 @@ FiniteVolumeEquation<Vector2D> laplacian(Scalar gamma, VectorFiniteVolumeField &
 
             case VectorFiniteVolumeField::PARTIAL_SLIP:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
                 Scalar lambda = phi.boundaryRefValue(bd.face()).x;
 
                 Scalar a = lambda != 0. ? lambda * coeff / (lambda * coeff - 1.) : 0.;
@@ -69,25 +69,24 @@ FiniteVolumeEquation<Vector2D> laplacian(const ScalarFiniteVolumeField &gamma,
                                          VectorFiniteVolumeField &phi,
                                          Scalar theta)
 {
-    FiniteVolumeEquation<Vector2D> eqn(phi);
+    FiniteVolumeEquation<Vector2D> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
     const VectorFiniteVolumeField &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            Scalar coeff0 = gamma0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, cell, theta * -coeff);
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(nb.cell()) - phi0(cell)));
-        }
+        Scalar coeff = geom.laplacianWeight(face);
+        addFaceDifference(eqn, face, lIn, rIn, theta * gamma(face) * coeff);
+        addFaceSource(eqn, face, lIn, rIn, (1. - theta) * gamma0(face) * coeff * (phi0(face.rCell()) - phi0(face.lCell())));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
-            Scalar coeff0 = gamma0(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma(bd.face()) * geom.laplacianWeight(bd.face());
+            Scalar coeff0 = gamma0(bd.face()) * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -101,7 +100,7 @@ FiniteVolumeEquation<Vector2D> laplacian(const ScalarFiniteVolumeField &gamma,
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, theta * -coeff);
                 eqn.add(cell, cell, theta * coeff * outer(tw, tw));
@@ -3,27 +3,29 @@
 
 #include "FiniteVolume/Equation/FiniteVolumeEquation.h"
 
+#include "FaceLoop.h"
+
 namespace fv
 {
 template<class T>
 FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi, Scalar theta)
 {
-    FiniteVolumeEquation<T> eqn(phi);
+    FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
     const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.add(cell, cell, theta * -coeff);
-            eqn.addSource(cell, (1. - theta) * coeff * (phi0(nb.cell()) - phi0(cell)));
-        }
+        Scalar coeff = gamma * geom.laplacianWeight(face);
+        addFaceDifference(eqn, face, lIn, rIn, theta * coeff);
+        addFaceSource(eqn, face, lIn, rIn, (1. - theta) * coeff * (phi0(face.rCell()) - phi0(face.lCell())));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -49,20 +51,19 @@ FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi, Scala
 template<class T>
 FiniteVolumeEquation<T> laplacian(Scalar gamma, FiniteVolumeField<T> &phi)
 {
-    FiniteVolumeEquation<T> eqn(phi);
+    FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, nb.cell(), coeff);
-            eqn.add(cell, cell, -coeff);
-        }
+        addFaceDifference(eqn, face, lIn, rIn, gamma * geom.laplacianWeight(face));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -89,25 +90,24 @@ FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
                                   FiniteVolumeField<T> &phi,
                                   Scalar theta)
 {
-    FiniteVolumeEquation<T> eqn(phi);
+    FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
     const ScalarFiniteVolumeField &gamma0 = gamma.oldField(0);
     const FiniteVolumeField<T> &phi0 = phi.oldField(0);
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            Scalar coeff0 = gamma0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, cell, theta * -coeff);
-            eqn.add(cell, nb.cell(), theta * coeff);
-            eqn.addSource(cell, (1. - theta) * coeff0 * (phi0(nb.cell()) - phi0(cell)));
-        }
+        Scalar coeff = geom.laplacianWeight(face);
+        addFaceDifference(eqn, face, lIn, rIn, theta * gamma(face) * coeff);
+        addFaceSource(eqn, face, lIn, rIn, (1. - theta) * gamma0(face) * coeff * (phi0(face.rCell()) - phi0(face.lCell())));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
-            Scalar coeff0 = gamma0(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma(bd.face()) * geom.laplacianWeight(bd.face());
+            Scalar coeff0 = gamma0(bd.face()) * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -134,20 +134,19 @@ template<class T>
 FiniteVolumeEquation<T> laplacian(const ScalarFiniteVolumeField &gamma,
                                   FiniteVolumeField<T> &phi)
 {
-    FiniteVolumeEquation<T> eqn(phi);
+    FiniteVolumeEquation<T> eqn(phi, faceLoopNnz(*phi.grid()));
+    const GridGeometry &geom = phi.grid()->geometry();
 
-    for (const Cell &cell: phi.cells())
+    forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            eqn.add(cell, cell, -coeff);
-            eqn.add(cell, nb.cell(), coeff);
-        }
+        addFaceDifference(eqn, face, lIn, rIn, gamma(face) * geom.laplacianWeight(face));
+    });
 
+    for (const Cell &cell: phi.cells())
+    {
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = gamma(bd.face()) * geom.laplacianWeight(bd.face());
 
             switch (phi.boundaryType(bd.face()))
             {
@@ -1,23 +1,28 @@
 #include "Geometry/Tensor2D.h"
 
 #include "Source.h"
+#include "FaceLoop.h"
 
 Vector src::div(const VectorFiniteVolumeField &field, const CellGroup &cells)
 {
     Vector divU(field.grid()->localCells().size());
+    const IndexMap &idxMap = *field.indexMap();
+    const GridGeometry &geom = field.grid()->geometry();
 
-    for (const Cell &cell: cells)
+    fv::forEachInteriorFace(*field.grid(), cells, [&](const Face &face, bool lIn, bool rIn)
     {
-        Scalar divUc = 0.;
+        Scalar flux = dot(field(face), geom.sf(face));
 
-        for (const InteriorLink &nb: cell.neighbours())
-            divUc += dot(field(nb.face()), nb.outwardNorm());
+        if (lIn)
+            divU(idxMap.local(face.lCell(), 0)) += flux;
 
-        for (const BoundaryLink &bd: cell.boundaries())
-            divUc += dot(field(bd.face()), bd.outwardNorm());
+        if (rIn)
+            divU(idxMap.local(face.rCell(), 0)) -= flux;
+    });
 
-        divU(field.indexMap()->local(cell, 0)) = divUc;
-    }
+    for (const Cell &cell: cells)
+        for (const BoundaryLink &bd: cell.boundaries())
+            divU(idxMap.local(cell, 0)) += dot(field(bd.face()), bd.outwardNorm());
 
     return divU;
 }
@@ -31,26 +36,27 @@ Vector src::laplacian(Scalar gamma,
                       const ScalarFiniteVolumeField &phi)
 {
     Vector lapPhi(phi.grid()->localCells().size());
+    const IndexMap &idxMap = *phi.indexMap();
+    const GridGeometry &geom = phi.grid()->geometry();
 
-    for (const Cell &cell: phi.cells())
+    fv::forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        Scalar tmp = 0.;
+        Scalar flux = gamma * geom.laplacianWeight(face) * (phi(face.rCell()) - phi(face.lCell()));
 
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            tmp += (phi(nb.cell()) - phi(cell)) * coeff;
-        }
+        if (lIn)
+            lapPhi(idxMap.local(face.lCell(), 0)) += flux;
 
+        if (rIn)
+            lapPhi(idxMap.local(face.rCell(), 0)) -= flux;
+    });
+
+    for (const Cell &cell: phi.cells())
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
-            tmp += (phi(bd.face()) - phi(cell)) * coeff;
+            Scalar coeff = gamma * geom.laplacianWeight(bd.face());
+            lapPhi(idxMap.local(cell, 0)) += (phi(bd.face()) - phi(cell)) * coeff;
         }
 
-        lapPhi(phi.indexMap()->local(cell, 0)) = tmp;
-    }
-
     return lapPhi;
 }
 
@@ -58,27 +64,27 @@ Vector src::laplacian(const ScalarFiniteVolumeField &gamma,
                       const ScalarFiniteVolumeField &phi)
 {
     Vector lapPhi(2 * phi.grid()->localCells().size());
+    const IndexMap &idxMap = *phi.indexMap();
+    const GridGeometry &geom = phi.grid()->geometry();
 
-    for (const Cell &cell: phi.cells())
+    fv::forEachInteriorFace(*phi.grid(), phi.cells(), [&](const Face &face, bool lIn, bool rIn)
     {
-        Vector2D tmp = Vector2D(0., 0.);
+        Scalar flux = gamma(face) * geom.laplacianWeight(face) * (phi(face.rCell()) - phi(face.lCell()));
 
-        for (const InteriorLink &nb: cell.neighbours())
-        {
-            Scalar coeff = gamma(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            tmp += (phi(nb.cell()) - phi(cell)) * coeff;
-        }
+        if (lIn)
+            lapPhi(idxMap.local(face.lCell(), 0)) += flux;
 
+        if (rIn)
+            lapPhi(idxMap.local(face.rCell(), 0)) -= flux;
+    });
+
+    for (const Cell &cell: phi.cells())
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = gamma(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
-            tmp += (phi(bd.face()) - phi(cell)) * coeff;
+            Scalar coeff = gamma(bd.face()) * geom.laplacianWeight(bd.face());
+            lapPhi(idxMap.local(cell, 0)) += (phi(bd.face()) - phi(cell)) * coeff;
         }
 
-        lapPhi(phi.indexMap()->local(cell, 0)) = tmp.x;
-        lapPhi(phi.indexMap()->local(cell, 1)) = tmp.y;
-    }
-
     return lapPhi;
 }
 
@@ -5,13 +5,14 @@
 VectorFvmEquation fv::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, VectorFiniteVolumeField &u, Scalar theta)
 {
     VectorFvmEquation eqn(u, 5);
+    const GridGeometry &geom = u.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
     for(const Cell &cell: u.cells())
     {
         for(const InteriorLink &nb: cell.neighbours())
         {
-            Scalar coeff = mu * dot(nb.rc(), nb.sf()) / nb.rc().magSqr();
+            Scalar coeff = mu * geom.laplacianWeight(nb.face());
 
             eqn.add(cell, nb.cell(), coeff * theta);
             eqn.add(cell, cell, -coeff * theta);
@@ -26,7 +27,7 @@ VectorFvmEquation fv::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vect
             {
             case VectorFiniteVolumeField::FIXED:
             {
-                Scalar coeff = mu * dot(bd.rf(), bd.sf()) / bd.rf().magSqr();
+                Scalar coeff = mu * geom.laplacianWeight(bd.face());
 
                 eqn.addSource(cell, coeff * u(bd.face()) * theta);
                 eqn.add(cell, cell, -coeff * theta);
@@ -48,18 +49,19 @@ VectorFvmEquation fv::divSigma(Scalar mu, const ScalarFiniteVolumeField &p, Vect
 VectorFvmEquation fv::divSigma(const ScalarFiniteVolumeField &mu, const ScalarFiniteVolumeField &p, VectorFiniteVolumeField &u, Scalar theta)
 {
     VectorFvmEquation eqn(u, 5);
+    const GridGeometry &geom = u.grid()->geometry();
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
     for(const Cell &cell: u.cells())
     {
         for(const InteriorLink &nb: cell.neighbours())
         {
-            Scalar coeff = mu(nb.face()) * dot(nb.rc(), nb.sf()) / nb.rc().magSqr();
+            Scalar coeff = mu(nb.face()) * geom.laplacianWeight(nb.face());
 
             eqn.add(cell, nb.cell(), coeff * theta);
             eqn.add(cell, cell, -coeff * theta);
 
-            Tensor2D tau0 = mu(nb.face()) * outer(u0(nb.cell()) - u0(cell), nb.rc() / nb.rc().magSqr());
+            Tensor2D tau0 = mu(nb.face()) * outer(u0(nb.cell()) - u0(cell), geom.laplacianVec(nb));
             eqn.addSource(cell,
                           -p(nb.face()) * nb.sf()
                           + dot(tau0, nb.sf()) * (1. - theta)
@@ -72,11 +74,11 @@ VectorFvmEquation fv::divSigma(const ScalarFiniteVolumeField &mu, const ScalarFi
             {
             case VectorFiniteVolumeField::FIXED:
             {
-                Scalar coeff = mu(bd.face()) * dot(bd.rf(), bd.sf()) / bd.rf().magSqr();
+                Scalar coeff = mu(bd.face()) * geom.laplacianWeight(bd.face());
                 eqn.addSource(cell, coeff * theta);
                 eqn.add(cell, cell, -coeff * theta);
 
-                Tensor2D tau0 = mu(bd.face()) * outer(u0(bd.face()) - u0(cell), bd.rf() / bd.rf().magSqr());
+                Tensor2D tau0 = mu(bd.face()) * outer(u0(bd.face()) - u0(cell), geom.laplacianVec(bd.face()));
                 eqn.addSource(cell,
                               -p(bd.face()) * bd.sf()
                               + dot(tau0, bd.sf()) * (1. - theta)
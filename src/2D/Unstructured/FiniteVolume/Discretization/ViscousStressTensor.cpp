@@ -5,6 +5,7 @@
 VectorFvmEquation fv::divTau(const ScalarFiniteVolumeField &mu, VectorFiniteVolumeField &u, Scalar theta)
 {
     VectorFvmEquation eqn(u);
+    const GridGeometry &geom = u.grid()->geometry();
     const ScalarFiniteVolumeField &mu0 = mu.oldField(0);
     const VectorFiniteVolumeField &u0 = u.oldField(0);
 
@@ -12,8 +13,8 @@ VectorFvmEquation fv::divTau(const ScalarFiniteVolumeField &mu, VectorFiniteVolu
     {
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Scalar coeff = mu(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
-            Scalar coeff0 = mu0(nb.face()) * dot(nb.rCellVec(), nb.outwardNorm()) / nb.rCellVec().magSqr();
+            Scalar coeff = mu(nb.face()) * geom.laplacianWeight(nb.face());
+            Scalar coeff0 = mu0(nb.face()) * geom.laplacianWeight(nb.face());
             eqn.add(cell, cell, theta * -coeff);
             eqn.add(cell, nb.cell(), theta * coeff);
             eqn.addSource(cell, (1. - theta) * coeff0 * (u0(nb.cell()) - u0(cell)));
@@ -21,8 +22,8 @@ VectorFvmEquation fv::divTau(const ScalarFiniteVolumeField &mu, VectorFiniteVolu
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Scalar coeff = mu(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
-            Scalar coeff0 = mu0(bd.face()) * dot(bd.rFaceVec(), bd.outwardNorm()) / bd.rFaceVec().magSqr();
+            Scalar coeff = mu(bd.face()) * geom.laplacianWeight(bd.face());
+            Scalar coeff0 = mu0(bd.face()) * geom.laplacianWeight(bd.face());
 
             switch (u.boundaryType(bd.face()))
             {
@@ -36,7 +37,7 @@ VectorFvmEquation fv::divTau(const ScalarFiniteVolumeField &mu, VectorFiniteVolu
                 break;
             case VectorFiniteVolumeField::SYMMETRY:
             {
-                Vector2D tw = bd.outwardNorm().tangentVec().unitVec();
+                Vector2D tw = geom.tangent(bd.face());
 
                 eqn.add(cell, cell, theta * -coeff);
                 eqn.add(cell, cell, theta * coeff * outer(tw, tw));
@@ -6,6 +6,7 @@
 
 #include "Math/SparseMatrixSolverFactory.h"
 #include "Math/TrilinosMueluSparseMatrixSolver.h"
+#include "Math/AutotuningSparseMatrixSolver.h"
 
 template<class T>
 FiniteVolumeEquation<T>::FiniteVolumeEquation(const Input &input,
@@ -56,7 +57,13 @@ void FiniteVolumeEquation<T>::configureSparseSolver(const Input &input, const Co
         throw Exception("FiniteVolumeEquation<T>", "configureSparseSolver", "equation \"" + name + "\", lib \"" + lib +
                         "\" does not support multiple processes in its current configuration.");
 
-    solver_->setup(input.caseInput().get_child("LinearAlgebra." + name));
+    auto parameters = input.caseInput().get_child("LinearAlgebra." + name);
+
+    if (lib == "autotune")
+        parameters.put("autotuneFile", parameters.get<std::string>("autotuneFile", name + "Autotuned.info"));
+
+    solver_->setup(parameters);
+    solver_->setGuessExtrapolationOrder(parameters.get<int>("guessExtrapolationOrder", 0));
 
     comm.printf("Initialized sparse matrix solver for equation \"%s\" using lib%s.\n", name.c_str(), lib.c_str());
 }
@@ -69,14 +76,19 @@ Scalar FiniteVolumeEquation<T>::solve()
                         "must allocate a SparseMatrixSolver object before attempting to solve.");
 
     solver_->setRank(getRank());
-    solver_->set(rowPtr_, colInd_, vals_);
+    solver_->setLocal(rowPtr_, colInd_, vals_, field_.indexMap()->columnGlobalIndices());
     solver_->setRhs(-rhs_);
 
     if (solver_->type() == SparseMatrixSolver::TRILINOS_MUELU)
         std::static_pointer_cast<TrilinosMueluSparseMatrixSolver>(solver_)->setCoordinates(
                     field_.grid()->localCells().coordinates());
+    else if (solver_->type() == SparseMatrixSolver::AUTOTUNE)
+        std::static_pointer_cast<AutotuningSparseMatrixSolver>(solver_)->setCoordinates(
+                    field_.grid()->localCells().coordinates());
 
+    solver_->setExtrapolatedGuess(getRank());
     solver_->solve();
+    solver_->storeSolution(getRank());
 
     mapFromSparseSolver();
 
@@ -9,6 +9,7 @@ void IndexMap::init(const FiniteVolumeGrid2D &grid, Size nIndices)
 
     localIndices_.resize(nIndices_ * nCells_);
     globalIndices_.resize(nIndices_ * nCells_);
+    localColumns_.resize(nIndices_ * nCells_);
 
     update(grid);
 }
@@ -34,4 +35,25 @@ void IndexMap::update(const FiniteVolumeGrid2D &grid)
 
     //- Communicate global indices to other procs
     grid.sendMessages(globalIndices_, nIndices_);
+
+    //- Local column space. Owned columns coincide with the local row indices, buffer columns follow in order of owner
+    //- rank, which is the ordering Tpetra expects of a column map so no permutation is needed when importing
+    std::fill(localColumns_.begin(), localColumns_.end(), INACTIVE);
+    std::copy(localIndices_.begin(), localIndices_.end(), localColumns_.begin());
+
+    columnGlobalIndices_.resize(localIndex);
+    std::iota(columnGlobalIndices_.begin(), columnGlobalIndices_.end(), ownershipRange_.first);
+
+    for (const CellGroup &bufferGroup: grid.bufferGroups())
+        for (Size indexNo = 0; indexNo < nIndices_; ++indexNo)
+            for (const Cell &cell: bufferGroup)
+            {
+                Index globalIndex = globalIndices_[indexNo * nCells_ + cell.id()];
+
+                if (globalIndex == INACTIVE)
+                    continue;
+
+                localColumns_[indexNo * nCells_ + cell.id()] = columnGlobalIndices_.size();
+                columnGlobalIndices_.push_back(globalIndex);
+            }
 }
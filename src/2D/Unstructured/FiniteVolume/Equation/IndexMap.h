@@ -28,6 +28,17 @@ public:
     Index global(const Cell &cell, Label indexNo = 0) const
     { return globalIndices_[indexNo * nCells_ + cell.id()]; }
 
+    //- Column index in the local column space, owned indices first followed by the buffer indices grouped by owner
+    Index localColumn(const Cell &cell, Label indexNo = 0) const
+    { return localColumns_[indexNo * nCells_ + cell.id()]; }
+
+    //- Global index of each local column, used to build the column map of a distributed matrix
+    const std::vector<Index> &columnGlobalIndices() const
+    { return columnGlobalIndices_; }
+
+    Size nLocalColumns() const
+    { return columnGlobalIndices_.size(); }
+
     bool isActive(const Cell &cell) const
     { return globalIndices_[cell.id()] != -1; }
 
@@ -47,6 +58,8 @@ private:
     std::pair<Index, Index> ownershipRange_;
 
     std::vector<Index> localIndices_, globalIndices_;
+
+    std::vector<Index> localColumns_, columnGlobalIndices_;
 };
 
 #endif
@@ -13,13 +13,13 @@ FiniteVolumeEquation<Scalar>::FiniteVolumeEquation(ScalarFiniteVolumeField &fiel
 template<>
 void FiniteVolumeEquation<Scalar>::set(const Cell &cell, const Cell &nb, Scalar val)
 {
-    setCoeff(field_.indexMap()->local(cell, 0), field_.indexMap()->global(nb, 0), val);
+    setCoeff(field_.indexMap()->local(cell, 0), field_.indexMap()->localColumn(nb, 0), val);
 }
 
 template<>
 void FiniteVolumeEquation<Scalar>::add(const Cell &cell, const Cell &nb, Scalar val)
 {
-    addCoeff(field_.indexMap()->local(cell, 0), field_.indexMap()->global(nb, 0), val);
+    addCoeff(field_.indexMap()->local(cell, 0), field_.indexMap()->localColumn(nb, 0), val);
 }
 
 template<>
@@ -40,6 +40,12 @@ void FiniteVolumeEquation<Scalar>::setSource(const Cell &cell, Scalar val)
     setRhs(field_.indexMap()->local(cell, 0), val);
 }
 
+template<>
+Scalar FiniteVolumeEquation<Scalar>::get(const Cell &cell, const Cell &nb)
+{
+    return coeff(field_.indexMap()->local(cell, 0), field_.indexMap()->localColumn(nb, 0));
+}
+
 template<>
 void FiniteVolumeEquation<Scalar>::remove(const Cell &cell)
 {
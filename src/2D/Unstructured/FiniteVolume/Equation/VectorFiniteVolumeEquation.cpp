@@ -16,11 +16,11 @@ template<>
 void FiniteVolumeEquation<Vector2D>::set(const Cell &cell, const Cell &nb, Scalar val)
 {
     setCoeff(field_.indexMap()->local(cell, 0),
-             field_.indexMap()->global(nb, 0),
+             field_.indexMap()->localColumn(nb, 0),
              val);
 
     setCoeff(field_.indexMap()->local(cell, 1),
-             field_.indexMap()->global(nb, 1),
+             field_.indexMap()->localColumn(nb, 1),
              val);
 }
 
@@ -28,11 +28,11 @@ template<>
 void FiniteVolumeEquation<Vector2D>::add(const Cell &cell, const Cell &nb, Scalar val)
 {
     addCoeff(field_.indexMap()->local(cell, 0),
-             field_.indexMap()->global(nb, 0),
+             field_.indexMap()->localColumn(nb, 0),
              val);
 
     addCoeff(field_.indexMap()->local(cell, 1),
-             field_.indexMap()->global(nb, 1),
+             field_.indexMap()->localColumn(nb, 1),
              val);
 }
 
@@ -48,11 +48,11 @@ template<>
 void FiniteVolumeEquation<Vector2D>::add(const Cell &cell, const Cell &nb, const Vector2D &val)
 {
     addCoeff(field_.indexMap()->local(cell, 0),
-             field_.indexMap()->global(nb, 0),
+             field_.indexMap()->localColumn(nb, 0),
              val.x);
 
     addCoeff(field_.indexMap()->local(cell, 1),
-             field_.indexMap()->global(nb, 1),
+             field_.indexMap()->localColumn(nb, 1),
              val.y);
 }
 
@@ -61,22 +61,22 @@ template<>
 void FiniteVolumeEquation<Vector2D>::add(const Cell &cell, const Cell &nb, const Tensor2D &val)
 {
     addCoeff(field_.indexMap()->local(cell, 0),
-             field_.indexMap()->global(nb, 0),
+             field_.indexMap()->localColumn(nb, 0),
              val.xx);
 
     //- Added this to avoid coupling whenever possible (i.e. cartesian domains)
     if(val.xy != 0.)
         addCoeff(field_.indexMap()->local(cell, 0),
-                 field_.indexMap()->global(nb, 1),
+                 field_.indexMap()->localColumn(nb, 1),
                  val.xy);
 
     if(val.yx != 0.)
         addCoeff(field_.indexMap()->local(cell, 1),
-                 field_.indexMap()->global(nb, 0),
+                 field_.indexMap()->localColumn(nb, 0),
                  val.yx);
 
     addCoeff(field_.indexMap()->local(cell, 1),
-             field_.indexMap()->global(nb, 1),
+             field_.indexMap()->localColumn(nb, 1),
              val.yy);
 }
 
@@ -85,8 +85,8 @@ Vector2D FiniteVolumeEquation<Vector2D>::get(const Cell &cell, const Cell &nb)
 {
     Index rowX = field_.indexMap()->local(cell, 0);
     Index rowY = field_.indexMap()->local(cell, 1);
-    Index colX = field_.indexMap()->global(nb, 0);
-    Index colY = field_.indexMap()->global(nb, 1);
+    Index colX = field_.indexMap()->localColumn(nb, 0);
+    Index colY = field_.indexMap()->localColumn(nb, 1);
 
     return Vector2D(coeff(rowX, colX), coeff(rowY, colY));
 }
@@ -21,6 +21,12 @@ public:
         VOLUME, DISTANCE
     };
 
+    //- Value arrays that are copied into the field history
+    enum HistoryData
+    {
+        NO_DATA = 0, CELL_DATA = 1, FACE_DATA = 2, NODE_DATA = 4, ALL_DATA = 7
+    };
+
     //- Constructors
     explicit FiniteVolumeField(const std::shared_ptr<const FiniteVolumeGrid2D> &grid,
                                const std::string &name,
@@ -176,21 +182,32 @@ public:
     virtual void setIndexMap(const std::shared_ptr<IndexMap> &indexMap)
     { indexMap_ = indexMap; }
 
-    //- Field history
+    //- Field history. Previous time steps are kept in a fixed-capacity ring, saving a time step rotates the ring
+    //- and copies the declared value arrays into the oldest slot
     FiniteVolumeField &savePreviousTimeStep(Scalar timeStep, int nPreviousFields);
 
     FiniteVolumeField &savePreviousIteration();
 
     void clearHistory();
 
+    //- Declare which value arrays are needed from the history, any combination of HistoryData flags
+    void setHistoryData(int historyData)
+    { historyData_ = historyData; }
+
+    int historyData() const
+    { return historyData_; }
+
+    int nPreviousTimeSteps() const
+    { return previousTimeSteps_.size(); }
+
     FiniteVolumeField &oldField(int i)
-    { return *previousTimeSteps_[i].second; }
+    { return *previousTimeSteps_[historySlot(i)].second; }
 
     const FiniteVolumeField &oldField(int i) const
-    { return *previousTimeSteps_[i].second; }
+    { return *previousTimeSteps_[historySlot(i)].second; }
 
     Scalar oldTimeStep(int i) const
-    { return previousTimeSteps_[i].first; }
+    { return previousTimeSteps_[historySlot(i)].first; }
 
     const FiniteVolumeField &prevIteration() const
     { return *previousIteration_; }
@@ -215,6 +232,11 @@ public:
 
     void setGrid(const std::shared_ptr<const FiniteVolumeGrid2D> &grid);
 
+    //- Maps the cell values and history onto an adapted grid, each new cell taking the weighted sum of the old cells
+    //- it overlaps. Integer fields take the value of the old cell with the largest overlap. Face and node values are
+    //- resized, fixed boundary faces are reset to their reference values
+    void project(const std::vector<std::vector<std::pair<Label, Scalar>>> &projection);
+
     const std::shared_ptr<const FiniteVolumeGrid2D> &grid() const
     { return grid_; }
 
@@ -232,6 +254,14 @@ protected:
 
     void setBoundaryRefValues(const Input &input);
 
+    //- Field history
+    int historySlot(int i) const
+    { return (historyHead_ + i) % previousTimeSteps_.size(); }
+
+    std::shared_ptr<FiniteVolumeField<T>> makeHistoryField() const;
+
+    void copyHistoryData(FiniteVolumeField<T> &field) const;
+
     //- Data members
     std::unordered_map<std::string, std::pair<BoundaryType, T> > patchBoundaries_;
 
@@ -244,8 +274,12 @@ protected:
     //- Misc data
     std::vector<T> faces_, nodes_;
 
-    //- Field history
-    std::deque<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
+    //- Field history, oldField(0) is stored at historyHead_
+    std::vector<std::pair<Scalar, std::shared_ptr<FiniteVolumeField<T>>>> previousTimeSteps_;
+
+    int historyHead_ = 0;
+
+    int historyData_ = ALL_DATA;
 
     std::shared_ptr<FiniteVolumeField<T>> previousIteration_;
 
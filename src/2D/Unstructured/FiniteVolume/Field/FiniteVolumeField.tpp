@@ -1,4 +1,6 @@
 #include <fstream>
+#include <algorithm>
+#include <type_traits>
 
 #include <boost/algorithm/string.hpp>
 
@@ -99,6 +101,12 @@ template<class T>
 void FiniteVolumeField<T>::copyBoundaryTypes(const FiniteVolumeField &other)
 {
     patchBoundaries_ = other.patchBoundaries_;
+
+    for (auto &prev: previousTimeSteps_)
+        prev.second->patchBoundaries_ = patchBoundaries_;
+
+    if (previousIteration_)
+        previousIteration_->patchBoundaries_ = patchBoundaries_;
 }
 
 template<class T>
@@ -144,18 +152,20 @@ void FiniteVolumeField<T>::interpolateFaces(const TFunc &alpha)
 template<class T>
 void FiniteVolumeField<T>::interpolateFaces(InterpolationType type)
 {
+    const GridGeometry &geom = grid_->geometry();
+
     switch (type)
     {
     case VOLUME:
-        interpolateFaces([](const Face &face)
+        interpolateFaces([&geom](const Face &face)
         {
-            return face.volumeWeight();
+            return geom.volumeWeight(face);
         });
         break;
     case DISTANCE:
-        interpolateFaces([](const Face &face)
+        interpolateFaces([&geom](const Face &face)
         {
-            return face.distanceWeight();
+            return geom.distanceWeight(face);
         });
         break;
     }
@@ -208,33 +218,38 @@ void FiniteVolumeField<T>::interpolateNodes()
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousTimeStep(Scalar timeStep, int nPreviousFields)
 {
-    std::shared_ptr<FiniteVolumeField<T>> tmp;
-
-    if(previousTimeSteps_.size() >= nPreviousFields)
+    //- (Re)build the ring if the capacity or grid changed. All slots start from the current field, so that
+    //- multi-level schemes are first order on the first step
+    if (previousTimeSteps_.size() != nPreviousFields
+        || (!previousTimeSteps_.empty() && previousTimeSteps_.front().second->grid_ != grid_))
     {
-        tmp = previousTimeSteps_.back().second;
-        *tmp = *this;
-    }
-    else
-        tmp = std::make_shared<FiniteVolumeField<T>>(*this);
+        previousTimeSteps_.clear();
+        historyHead_ = 0;
 
-    tmp->clearHistory();
+        for (int i = 0; i < nPreviousFields; ++i)
+        {
+            previousTimeSteps_.emplace_back(timeStep, makeHistoryField());
+            copyHistoryData(*previousTimeSteps_.back().second);
+        }
 
-    previousTimeSteps_.emplace_front(timeStep, tmp);
-    previousTimeSteps_.resize(nPreviousFields, previousTimeSteps_.back());
+        return oldField(0);
+    }
 
-    return *previousTimeSteps_.front().second;
+    //- The oldest slot becomes oldField(0)
+    historyHead_ = historySlot(nPreviousFields - 1);
+    previousTimeSteps_[historyHead_].first = timeStep;
+    copyHistoryData(*previousTimeSteps_[historyHead_].second);
+
+    return oldField(0);
 }
 
 template<class T>
 FiniteVolumeField<T> &FiniteVolumeField<T>::savePreviousIteration()
 {
-    if(previousIteration_)
-        *previousIteration_ = *this;
-    else
-        previousIteration_ = std::make_shared<FiniteVolumeField<T>>(*this);
+    if (!previousIteration_ || previousIteration_->grid_ != grid_)
+        previousIteration_ = makeHistoryField();
 
-    previousIteration_->clearHistory();
+    copyHistoryData(*previousIteration_);
     return *previousIteration_;
 }
 
@@ -243,6 +258,7 @@ void FiniteVolumeField<T>::clearHistory()
 {
     previousIteration_ = nullptr;
     previousTimeSteps_.clear();
+    historyHead_ = 0;
 }
 
 //- Parallel
@@ -407,6 +423,46 @@ void FiniteVolumeField<T>::setGrid(const std::shared_ptr<const FiniteVolumeGrid2
     cellGroup_ = nullptr;
 }
 
+template<class T>
+void FiniteVolumeField<T>::project(const std::vector<std::vector<std::pair<Label, Scalar>>> &projection)
+{
+    std::vector<T> vals(projection.size(), T());
+
+    for (Label id = 0; id < projection.size(); ++id)
+        if (std::is_integral<T>::value)
+        {
+            //- Weighted sums would truncate, so integers are injected
+            auto weight = std::max_element(projection[id].begin(), projection[id].end(),
+                                           [](const std::pair<Label, Scalar> &lhs, const std::pair<Label, Scalar> &rhs)
+            { return lhs.second < rhs.second; });
+
+            vals[id] = (*this)(weight->first);
+        }
+        else
+            for (const auto &weight: projection[id])
+                vals[id] += weight.second * (*this)(weight.first);
+
+    std::vector<T>::swap(vals);
+
+    if (!faces_.empty())
+    {
+        faces_.assign(grid_->faces().size(), T());
+
+        for (const FaceGroup &patch: grid_->patches())
+            if (boundaryType(patch) == FIXED)
+                for (const Face &face: patch)
+                    faces_[face.id()] = boundaryRefValue(patch);
+    }
+
+    if (!nodes_.empty())
+        nodes_.assign(grid_->nodes().size(), T());
+
+    for (auto &previousTimeStep: previousTimeSteps_)
+        previousTimeStep.second->project(projection);
+
+    previousIteration_ = nullptr;
+}
+
 //- Debug
 
 template<class T>
@@ -422,6 +478,28 @@ void FiniteVolumeField<T>::writeToFile(const std::string &filename) const
 
 //- Protected methods
 
+template<class T>
+std::shared_ptr<FiniteVolumeField<T>> FiniteVolumeField<T>::makeHistoryField() const
+{
+    auto field = std::make_shared<FiniteVolumeField<T>>(grid_, this->name_, T(), hasFaces(), hasNodes(), cellGroup_, indexMap_);
+    field->patchBoundaries_ = patchBoundaries_;
+    return field;
+}
+
+template<class T>
+void FiniteVolumeField<T>::copyHistoryData(FiniteVolumeField<T> &field) const
+{
+    //- Sizes match the history field, so no reallocation takes place
+    if (historyData_ & CELL_DATA)
+        std::copy(this->begin(), this->end(), field.begin());
+
+    if (historyData_ & FACE_DATA)
+        std::copy(faces_.begin(), faces_.end(), field.faces_.begin());
+
+    if (historyData_ & NODE_DATA)
+        std::copy(nodes_.begin(), nodes_.end(), field.nodes_.begin());
+}
+
 template<class T>
 void FiniteVolumeField<T>::setBoundaryTypes(const Input &input)
 {
@@ -53,17 +53,13 @@ JacobianField::JacobianField(const VectorFiniteVolumeField& u, const std::shared
 
 void JacobianField::computeFaces()
 {
+    const GridGeometry &geom = grid_->geometry();
+
     for(const Face& f: grid_->interiorFaces())
-    {
-        Vector2D rc = f.rCell().centroid() - f.lCell().centroid();
-        (*this)(f) = outer(u_(f.rCell()) - u_(f.lCell()), rc/rc.magSqr());
-    }
+        (*this)(f) = outer(u_(f.rCell()) - u_(f.lCell()), geom.laplacianVec(f));
 
     for(const Face& f: grid_->boundaryFaces())
-    {
-        Vector2D rf = f.centroid() - f.lCell().centroid();
-        (*this)(f) = outer(u_(f) - u_(f.lCell()), rf/rf.magSqr());
-    }
+        (*this)(f) = outer(u_(f) - u_(f.lCell()), geom.laplacianVec(f));
 }
 
 void JacobianField::compute(const CellGroup& cells)
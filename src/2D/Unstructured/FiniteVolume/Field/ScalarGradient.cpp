@@ -43,18 +43,13 @@ ScalarGradient::ScalarGradient(const ScalarFiniteVolumeField &phi, const std::sh
 void ScalarGradient::computeFaces()
 {
     VectorFiniteVolumeField &gradPhi = *this;
+    const GridGeometry &geom = grid_->geometry();
 
     for (const Face &face: grid_->interiorFaces())
-    {
-        Vector2D rc = face.rCell().centroid() - face.lCell().centroid();
-        gradPhi(face) = (phi_(face.rCell()) - phi_(face.lCell())) * rc / rc.magSqr();
-    }
+        gradPhi(face) = (phi_(face.rCell()) - phi_(face.lCell())) * geom.laplacianVec(face);
 
     for (const Face &face: grid_->boundaryFaces())
-    {
-        Vector2D rf = face.centroid() - face.lCell().centroid();
-        gradPhi(face) = (phi_(face) - phi_(face.lCell())) * rf / rf.magSqr();
-    }
+        gradPhi(face) = (phi_(face) - phi_(face.lCell())) * geom.laplacianVec(face);
 }
 
 void ScalarGradient::compute(const CellGroup &group, Method method)
@@ -158,6 +153,7 @@ void ScalarGradient::computeAxisymmetric(const CellGroup &cells)
     fill(Vector2D(0., 0.), cells);
 
     auto &gradPhi = *this;
+    const GridGeometry &geom = grid_->geometry();
 
     for (const Cell &cell: cells)
     {
@@ -165,14 +161,14 @@ void ScalarGradient::computeAxisymmetric(const CellGroup &cells)
 
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(nb.face()).abs();
             tmp += pointwise(gradPhi(nb.face()), sf);
             sum += sf;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(bd.face()).abs();
             tmp += pointwise(gradPhi(bd.face()), sf);
             sum += sf;
         }
@@ -189,6 +185,7 @@ void ScalarGradient::computeAxisymmetric(const ScalarFiniteVolumeField &cw,
     fill(Vector2D(0., 0.), cells);
 
     auto &gradPhi = *this;
+    const GridGeometry &geom = grid_->geometry();
 
     for (const Cell &cell: cells)
     {
@@ -196,14 +193,14 @@ void ScalarGradient::computeAxisymmetric(const ScalarFiniteVolumeField &cw,
 
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(nb.face()).abs();
             tmp += pointwise(gradPhi(nb.face()) / fw(nb.face()), sf);
             sum += sf;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(bd.face()).abs();
             tmp += pointwise(gradPhi(bd.face()) / fw(bd.face()), sf);
             sum += sf;
         }
@@ -62,6 +62,7 @@ template<>
 void VectorFiniteVolumeField::faceToCellAxisymmetric(const CellGroup &cells)
 {
     auto &self = *this;
+    const GridGeometry &geom = grid_->geometry();
 
     for (const Cell &cell: cells)
     {
@@ -69,14 +70,14 @@ void VectorFiniteVolumeField::faceToCellAxisymmetric(const CellGroup &cells)
 
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(nb.face()).abs();
             tmp += pointwise(self(nb.face()), sf);
             sumSf += sf;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(bd.face()).abs();
             tmp += pointwise(self(bd.face()), sf);
             sumSf += sf;
         }
@@ -89,6 +90,7 @@ template<>
 void VectorFiniteVolumeField::faceToCellAxisymmetric(const FiniteVolumeField<Scalar> &cw, const FiniteVolumeField<Scalar> &fw, const CellGroup &cells)
 {
     auto &self = *this;
+    const GridGeometry &geom = grid_->geometry();
 
     for (const Cell &cell: cells)
     {
@@ -96,14 +98,14 @@ void VectorFiniteVolumeField::faceToCellAxisymmetric(const FiniteVolumeField<Sca
 
         for (const InteriorLink &nb: cell.neighbours())
         {
-            Vector2D sf = nb.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(nb.face()).abs();
             tmp += pointwise(self(nb.face()), sf) / fw(nb.face());
             sumSf += sf;
         }
 
         for (const BoundaryLink &bd: cell.boundaries())
         {
-            Vector2D sf = bd.polarOutwardNorm().abs();
+            Vector2D sf = geom.polarSf(bd.face()).abs();
             tmp += pointwise(self(bd.face()), sf) / fw(bd.face());
             sumSf += sf;
         }
@@ -0,0 +1,151 @@
+#include <algorithm>
+
+#include "CollisionBroadPhase.h"
+
+CollisionBroadPhase::CollisionBroadPhase(Scalar range, Scalar skinWidth)
+    :
+      range_(range),
+      skinWidth_(skinWidth)
+{
+
+}
+
+void CollisionBroadPhase::updateCandidatePairs(const std::vector<std::shared_ptr<ImmersedBoundaryObject>> &ibObjs)
+{
+    candidatePairs_.clear();
+    boxes_.clear();
+    bins_.clear();
+
+    if (ibObjs.size() < 2)
+        return;
+
+    //- Bounding boxes are expanded by half the range on each side, so boxes within range of each other overlap
+    std::vector<Scalar> sizes;
+
+    for (const auto &ibObj: ibObjs)
+    {
+        auto box = ibObj->shape().boundingBox();
+        box.min_corner() -= Vector2D(range_ / 2., range_ / 2.);
+        box.max_corner() += Vector2D(range_ / 2., range_ / 2.);
+
+        sizes.push_back(std::max(box.max_corner().x - box.min_corner().x, box.max_corner().y - box.min_corner().y));
+        boxes_.push_back(box);
+    }
+
+    //- The bin width is the median box size, so a few large objects do not collapse everything into a few bins.
+    //- Overlapping boxes no larger than a bin always have their centers in adjacent bins, larger boxes are checked
+    //- against every other box
+    std::vector<Scalar> sortedSizes = sizes;
+    std::nth_element(sortedSizes.begin(), sortedSizes.begin() + sortedSizes.size() / 2, sortedSizes.end());
+    Scalar h = sortedSizes[sortedSizes.size() / 2];
+
+    if (h <= 0.)
+        h = 1.;
+
+    auto binIndex = [h](const boost::geometry::model::box<Point2D> &box)
+    {
+        Point2D center = (box.min_corner() + box.max_corner()) / 2.;
+        return std::make_pair((long long) std::floor(center.x / h), (long long) std::floor(center.y / h));
+    };
+
+    auto binKey = [](long long i, long long j)
+    {
+        return (static_cast<std::uint64_t>(i) << 32) | static_cast<std::uint32_t>(j);
+    };
+
+    std::vector<Label> oversized;
+    bins_.reserve(boxes_.size());
+
+    for (Label p = 0; p < boxes_.size(); ++p)
+        if (sizes[p] > h)
+            oversized.push_back(p);
+        else
+        {
+            auto ij = binIndex(boxes_[p]);
+            bins_.push_back(std::make_pair(binKey(ij.first, ij.second), p));
+        }
+
+    std::sort(bins_.begin(), bins_.end());
+
+    auto overlaps = [](const boost::geometry::model::box<Point2D> &a, const boost::geometry::model::box<Point2D> &b)
+    {
+        return a.min_corner().x <= b.max_corner().x && b.min_corner().x <= a.max_corner().x
+                && a.min_corner().y <= b.max_corner().y && b.min_corner().y <= a.max_corner().y;
+    };
+
+    auto compareKey = [](const std::pair<std::uint64_t, Label> &lhs, std::uint64_t key) { return lhs.first < key; };
+
+    for (const auto &bin: bins_)
+    {
+        Label p = bin.second;
+        auto ij = binIndex(boxes_[p]);
+
+        for (long long i = ij.first - 1; i <= ij.first + 1; ++i)
+            for (long long j = ij.second - 1; j <= ij.second + 1; ++j)
+            {
+                std::uint64_t key = binKey(i, j);
+
+                for (auto it = std::lower_bound(bins_.begin(), bins_.end(), key, compareKey);
+                     it != bins_.end() && it->first == key; ++it)
+                {
+                    Label q = it->second;
+
+                    if (q > p && overlaps(boxes_[p], boxes_[q]))
+                        candidatePairs_.push_back(std::make_pair(p, q));
+                }
+            }
+    }
+
+    for (Label p: oversized)
+        for (Label q = 0; q < boxes_.size(); ++q)
+        {
+            //- Pairs of two oversized boxes are only tested from the lower index
+            if (q == p || (sizes[q] > h && q < p))
+                continue;
+
+            if (overlaps(boxes_[p], boxes_[q]))
+                candidatePairs_.push_back(std::make_pair(std::min(p, q), std::max(p, q)));
+        }
+
+    //- Keep the narrow phase summation order independent of the bin layout
+    std::sort(candidatePairs_.begin(), candidatePairs_.end());
+}
+
+void CollisionBroadPhase::updateWallFaces(const std::vector<std::shared_ptr<ImmersedBoundaryObject>> &ibObjs,
+                                          const FiniteVolumeGrid2D &grid)
+{
+    wallFaces_.resize(ibObjs.size());
+
+    for (Label i = 0; i < ibObjs.size(); ++i)
+    {
+        const Shape2D &shape = ibObjs[i]->shape();
+        auto box = shape.boundingBox();
+
+        Point2D center = (box.min_corner() + box.max_corner()) / 2.;
+        Scalar radius = shape.type() == Shape2D::CIRCLE ? static_cast<const Circle &>(shape).radius()
+                                                        : (box.max_corner() - box.min_corner()).mag() / 2.;
+        radius += range_;
+
+        //- A skin width of zero defaults to a quarter of the bounding radius
+        Scalar skin = skinWidth_ > 0. ? skinWidth_ : radius / 4.;
+
+        WallFaceList &list = wallFaces_[i];
+
+        //- The cached faces remain valid while the bounding circle stays inside the previous query circle, and the
+        //- grid has not been rebuilt
+        if (list.radius >= 0. && list.gridRevision == grid.revision()
+                && (center - list.center).mag() + radius <= list.radius)
+            continue;
+
+        list.center = center;
+        list.gridRevision = grid.revision();
+        list.radius = radius + skin;
+        list.faces.clear();
+
+        for (const FaceGroup &patch: grid.patches())
+        {
+            auto faces = patch.itemsCoveredBy(Circle(list.center, list.radius));
+            list.faces.insert(list.faces.end(), faces.begin(), faces.end());
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef PHASE_COLLISION_BROAD_PHASE_H
+#define PHASE_COLLISION_BROAD_PHASE_H
+
+#include <cstdint>
+
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2D.h"
+
+#include "ImmersedBoundaryObject.h"
+
+class CollisionBroadPhase
+{
+public:
+
+    CollisionBroadPhase(Scalar range = 0., Scalar skinWidth = 0.);
+
+    //- Rebuild the candidate pairs from the current ib object bounding boxes
+    void updateCandidatePairs(const std::vector<std::shared_ptr<ImmersedBoundaryObject>> &ibObjs);
+
+    //- Re-query the wall faces of any ib object that has moved outside its skin
+    void updateWallFaces(const std::vector<std::shared_ptr<ImmersedBoundaryObject>> &ibObjs, const FiniteVolumeGrid2D &grid);
+
+    //- Pairs of ib object indices (p < q) whose bounding boxes, expanded by the collision range, overlap
+    const std::vector<std::pair<Label, Label>> &candidatePairs() const
+    { return candidatePairs_; }
+
+    //- Wall faces that may come within the collision range of an ib object
+    const std::vector<Ref<const Face>> &wallFaces(Label ibObjNo) const
+    { return wallFaces_[ibObjNo].faces; }
+
+private:
+
+    struct WallFaceList
+    {
+        Point2D center;
+        Scalar radius = -1.;
+        Size gridRevision = 0;
+        std::vector<Ref<const Face>> faces;
+    };
+
+    Scalar range_, skinWidth_;
+
+    //- Uniform grid bins, stored as (bin key, ib object index) sorted by key. Boxes larger than a bin are not binned
+    std::vector<std::pair<std::uint64_t, Label>> bins_;
+
+    std::vector<boost::geometry::model::box<Point2D>> boxes_;
+
+    std::vector<std::pair<Label, Label>> candidatePairs_;
+
+    std::vector<WallFaceList> wallFaces_;
+};
+
+#endif
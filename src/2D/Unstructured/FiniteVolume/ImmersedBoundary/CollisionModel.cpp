@@ -53,3 +53,26 @@ Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const Finite
 
     return fc;
 }
+
+Vector2D CollisionModel::force(const ImmersedBoundaryObject &ibObj, const std::vector<Ref<const Face>> &faces) const
+{
+    Vector2D fc = Vector2D(0., 0.);
+
+    if (ibObj.shape().type() == Shape2D::CIRCLE)
+    {
+        const Circle &c = static_cast<const Circle &>(ibObj.shape());
+        const Vector2D &xp = c.centroid();
+        Scalar r = c.radius();
+
+        for (const Face &f: faces)
+        {
+            const Vector2D &xq = f.centroid();
+            Scalar d = (xp - xq).mag();
+
+            if (d <= r + range_)
+                fc += (xp - xq) / eps_ * pow(r + range_ - d, 2);
+        }
+    }
+
+    return fc;
+}
@@ -13,6 +13,8 @@ public:
 
     virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const FiniteVolumeGrid2D& grid) const;
 
+    virtual Vector2D force(const ImmersedBoundaryObject& ibObj, const std::vector<Ref<const Face>>& faces) const;
+
 private:
 
     Scalar eps_, range_;
@@ -1,4 +1,7 @@
+#include <numeric>
+
 #include "Math/TrilinosAmesosSparseMatrixSolver.h"
+#include "Math/EigenSparseMatrixSolver.h"
 
 #include "DirectForcingImmersedBoundary.h"
 #include "DirectForcingImmersedBoundaryLeastSquaresQuadraticStencil.h"
@@ -53,66 +56,105 @@ void DirectForcingImmersedBoundary::updateCells()
     }
 
     cellStatus_->sendMessages();
+    updateStencils();
+    updateClusters();
 }
 
-FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::computeForcingTerm(const VectorFiniteVolumeField &u,
-                                                                                 Scalar timeStep,
-                                                                                 VectorFiniteVolumeField &fib) const
+const DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil &DirectForcingImmersedBoundary::stencil(const Cell &cell) const
 {
-    FiniteVolumeEquation<Vector2D> eqn(fib, 12);
-    for(const Cell& cell: u.cells())
+    if(cell.id() >= stencils_.size() || !stencils_[cell.id()])
+        throw Exception("DirectForcingImmersedBoundary", "stencil", "cell " + std::to_string(cell.id()) + " is not a local ib cell.");
+
+    return *stencils_[cell.id()];
+}
+
+void DirectForcingImmersedBoundary::solveForcingTerm(const VectorFiniteVolumeField &u,
+                                                    Scalar timeStep,
+                                                    VectorFiniteVolumeField &fib) const
+{
+    for(const Cell &cell: u.cells())
     {
-        if(localIbCells_.isInSet(cell))
-        {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+        if(localSolidCells_.isInSet(cell))
+            fib(cell) = (ibObj(cell)->velocity(cell.centroid()) - u(cell)) / timeStep;
+        else if(!localIbCells_.isInSet(cell))
+            fib(cell) = Vector2D(0., 0.);
+    }
 
-            auto beta = st.interpolationCoeffs(cell.centroid());
+    fib.sendMessages();
 
-            eqn.add(cell, cell, -timeStep);
+    std::vector<IbCellRow> rows(localIbCells_.size());
 
-            int i = 0;
-            for(const Cell *cellPtr: st.cells())
+    Index row = 0;
+    for(const Cell &cell: localIbCells_)
+    {
+        const auto &st = stencil(cell);
+        auto beta = st.interpolationCoeffs(cell.centroid());
+        IbCellRow &r = rows[row++];
+
+        r.diag = Tensor2D(-timeStep, 0., 0., -timeStep);
+        r.src = -u(cell);
+
+        int i = 0;
+        for(const Cell *cellPtr: st.cells())
+        {
+            r.cells.push_back(cellPtr);
+            r.coeffs.push_back(beta(0, i) * timeStep);
+            r.src += beta(0, i++) * u(*cellPtr);
+        }
+
+        for(const auto &cmpt: st.compatPts())
+            r.src += beta(0, i++) * cmpt.velocity();
+
+        for(const Face *facePtr: st.faces())
+            switch(u.boundaryType(*facePtr))
+            {
+            case VectorFiniteVolumeField::FIXED:
+                r.src += beta(0, i++) * u(*facePtr);
+                break;
+            case VectorFiniteVolumeField::SYMMETRY:
             {
-                eqn.add(cell, *cellPtr, beta(0, i) * timeStep);
-                eqn.addSource(cell, beta(0, i++) * u(*cellPtr));
+                Vector2D n = facePtr->norm().unitVec();
+                Vector2D t = n.tangentVec();
+                r.diag += beta(0, i) * timeStep * outer(t, t);
+                r.src += beta(0, i++) * dot(u(cell), t) * t;
+                break;
+            }
+            default:
+                throw Exception("DirectForcingImmersedBoundary", "solveForcingTerm", "grid boundary type not recognized.");
             }
+    }
 
-            for(const auto &cmpt: st.compatPts())
-                eqn.addSource(cell, beta(0, i++) * cmpt.velocity());
+    solveIbCellSystem(rows, fib);
+}
 
-            for(const Face *facePtr: st.faces())
-                switch(u.boundaryType(*facePtr))
-                {
-                case VectorFiniteVolumeField::FIXED:
-                    eqn.addSource(cell, beta(0, i++) * u(*facePtr));
-                    break;
-                case VectorFiniteVolumeField::SYMMETRY:
-                {
-                    Vector2D n = facePtr->norm().unitVec();
-                    Vector2D t = n.tangentVec();
-                    eqn.add(cell, cell, beta(0, i) * timeStep * outer(t, t));
-                    eqn.addSource(cell, beta(0, i++) * dot(u(cell), t) * t);
-                    break;
-                }
-                default:
-                    throw Exception("DirectForcingImmersedBoundary", "velocityBcs", "grid boundary type not recognized.");
-                }
+void DirectForcingImmersedBoundary::extendPressureGradient(VectorFiniteVolumeField &gradP) const
+{
+    gradP.sendMessages();
 
-            eqn.addSource(cell, -u(cell));
-        }
-        else if (localSolidCells_.isInSet(cell))
-        {
-            eqn.set(cell, cell, -1.);
-            eqn.setSource(cell, (ibObj(cell)->velocity(cell.centroid()) - u(cell)) / timeStep);
-        }
-        else
+    std::vector<IbCellRow> rows(localIbCells_.size());
+
+    Index row = 0;
+    for(const Cell &cell: localIbCells_)
+    {
+        const auto &st = stencil(cell);
+        auto beta = st.interpolationCoeffs(cell.centroid());
+        IbCellRow &r = rows[row++];
+
+        r.diag = Tensor2D(-1., 0., 0., -1.);
+        r.src = Vector2D(0., 0.);
+
+        int i = 0;
+        for(const Cell *cellPtr: st.cells())
         {
-            eqn.set(cell, cell, -1.);
-            eqn.setSource(cell, 0.);
+            r.cells.push_back(cellPtr);
+            r.coeffs.push_back(beta(0, i++));
         }
+
+        for(const auto &cmpt: st.compatPts())
+            r.src -= beta(0, i++) * cmpt.acceleration();
     }
 
-    return eqn;
+    solveIbCellSystem(rows, gradP);
 }
 
 FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::velocityBcs(VectorFiniteVolumeField &u,
@@ -125,7 +167,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::velocityBcs(Vector
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.interpolationCoeffs(cell.centroid());
 
             int i = 0;
@@ -173,7 +215,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::continuityVelocity
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.continuityConstrainedInterpolationCoeffs(cell.centroid());
 
             //std::cout << beta.m() << " " << beta.n() << std::endl;
@@ -237,7 +279,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::polarVelocityBcs(V
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.interpolationCoeffs(cell.centroid());
             Scalar vol = cell.polarVolume();
             int i = 0;
@@ -285,7 +327,7 @@ FiniteVolumeEquation<Vector2D> DirectForcingImmersedBoundary::continuityPolarVel
     {
         if(localIbCells_.isInSet(cell))
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
+            const auto &st = stencil(cell);
             auto beta = st.polarQuadraticContinuityConstrainedInterpolationCoeffs(cell.centroid());
 
             int i = 0;
@@ -343,155 +385,25 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                                            const ScalarFiniteVolumeField &p,
                                                            const Vector2D &g)
 {
-    struct Stress
-    {
-        Point2D pt;
-        Scalar p;
-        Tensor2D tau;
-    };
-
-    CrsEquation eqn;
-    eqn.setSparseSolver(std::make_shared<TrilinosAmesosSparseMatrixSolver>(grid_->comm(), Tpetra::DynamicProfile));
-
-
-    for(auto &ibObj: ibObjs_)
-    {
-        auto nLocalCells = grid_->comm().allGather(ibObj->ibCells().size());
-
-        auto indexStart = 6 * std::accumulate(
-                    nLocalCells.begin(),
-                    nLocalCells.begin() + grid_->comm().rank(), 0);
-
-        auto cellIdToIndexMap = std::vector<Index>(grid_->cells().size(), -1);
-
-        Index ibCellId = 0;
-        for(const Cell& cell: ibObj->ibCells())
-            cellIdToIndexMap[cell.id()] = indexStart + 6 * ibCellId++;
-
-        grid_->sendMessages(cellIdToIndexMap);
-
-        std::vector<Stress> stresses;
-        stresses.reserve(ibObj->ibCells().size());
-
-        eqn.clear();
-        Index row = 0;
-        for(const Cell &cell: ibObj->ibCells())
-        {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
-
-            //- Compute the stress tensor
-            Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
-
-            int i = 0;
-            for(const Cell *cell: st.cells())
-            {
-                Point2D x = cell->centroid();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {u(*cell).x, u(*cell).y});
-            }
-
-            for(const auto &compatPt: st.compatPts())
-            {
-                Point2D x = compatPt.pt();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {compatPt.velocity().x, compatPt.velocity().y});
-            }
-
-            Point2D xb = ibObj->nearestIntersect(cell.centroid());
-            auto coeffs = solve(A, rhs);
-            auto derivs = Matrix(2, 6, {
-                                     2. * xb.x, 0., xb.y, 1., 0., 0.,
-                                     0., 2. * xb.y, xb.x, 0., 1., 0.
-                                 }) * coeffs;
-
-            //- The tensor is tranposed here
-            auto tau = Tensor2D(derivs(0, 0), derivs(1, 0), derivs(0, 1), derivs(1, 1));
-            tau = mu * (tau + tau.transpose());
-
-            stresses.push_back(Stress{xb, 0., tau});
-
-            auto divTau = mu * Vector2D(4 * coeffs(0, 0) + 2 * coeffs(1, 0) + coeffs(2, 1),
-                                        2 * coeffs(0, 1) + 4 * coeffs(1, 1) + coeffs(2, 0));
-
-            eqn.addRows(st.nReconstructionPoints(), 12);
-
-            Index colStart = cellIdToIndexMap[cell.id()];
-            for(const Cell *cell: st.cells())
-            {
-                Point2D x = cell->centroid();
-
-                eqn.setCoeffs(row,
-                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-
-                eqn.setRhs(row++, -p(*cell));
-            }
-
-            for(const auto &compatPt: st.compatPts())
-            {
-                if(&cell == &compatPt.cell())
-                    continue;
-
-                Point2D x = compatPt.pt();
-
-                eqn.setCoeffs(row,
-                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-
-                Index colStart2 = cellIdToIndexMap[compatPt.cell().id()];
-
-                eqn.setCoeffs(row++,
-                {colStart2, colStart2 + 1, colStart2 + 2, colStart2 + 3, colStart2 + 4, colStart2 + 5},
-                {-x.x * x.x, -x.y * x.y, -x.x * x.y, -x.x, -x.y, -1.});
-            }
-
-            Vector2D n = ibObj->nearestEdgeUnitNormal(xb);
-
-            eqn.setCoeffs(row,
-            {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-            {2. * xb.x * n.x, 2. * xb.y * n.y, xb.y * n.x + xb.x * n.y, n.x, n.y, 0.});
-
-            eqn.setRhs(row++, rho * dot(ibObj->acceleration(xb), n) - dot(divTau, n));
-        }
-
-        eqn.setRank(eqn.rank(), 6 * ibObj->ibCells().size());
-        eqn.solveLeastSquares();
-
-        //- Extract the pressure coeffs and compute
-        for(int i = 0; i < 6 * ibObj->ibCells().size(); i += 6)
-        {
-            Scalar a = eqn.x(i);
-            Scalar b = eqn.x(i + 1);
-            Scalar c = eqn.x(i + 2);
-            Scalar d = eqn.x(i + 3);
-            Scalar e = eqn.x(i + 4);
-            Scalar f = eqn.x(i + 5);
-
-            Stress &stress = stresses[i / 6];
-            Point2D xb = stress.pt;
-            stress.p = a * xb.x * xb.x + b * xb.y * xb.y + c * xb.x * xb.y + d * xb.x + e * xb.y + f + rho * dot(xb, g);
-        }
+    auto stresses = surfaceStresses([rho](const Cell &) { return rho; },
+                                    [mu](const Cell &) { return mu; },
+                                    u, p, g);
 
-        stresses = grid_->comm().gatherv(grid_->comm().mainProcNo(), stresses);
+    std::vector<Vector2D> forces(ibObjs_.size(), Vector2D(0., 0.));
 
-        Vector2D force(0., 0.);
-
-        //- Integrate the stresses
-        if(grid_->comm().isMainProc())
+    //- Integrate the stresses
+    if(grid_->comm().isMainProc())
+        for(int objId = 0; objId < ibObjs_.size(); ++objId)
         {
-
-            std::sort(stresses.begin(), stresses.end(), [&ibObj](const Stress &lhs, const Stress &rhs)
-            {
-                return (lhs.pt - ibObj->shape().centroid()).angle()
-                        < (rhs.pt - ibObj->shape().centroid()).angle();
-            });
+            const auto &ibObj = ibObjs_[objId];
+            const auto &objStresses = stresses[objId];
 
             Vector2D fShear(0., 0.), fPressure(0., 0.);
 
-            for(int i = 0; i < stresses.size(); ++i)
+            for(int i = 0; i < objStresses.size(); ++i)
             {
-                auto qpa = stresses[i];
-                auto qpb = stresses[(i + 1) % stresses.size()];
+                const auto &qpa = objStresses[i];
+                const auto &qpb = objStresses[(i + 1) % objStresses.size()];
 
                 auto ptA = qpa.pt;
                 auto ptB = qpb.pt;
@@ -527,16 +439,18 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                 }
             }
 
-            force = fPressure + fShear + ibObj->rho * g * ibObj->shape().area();
+            forces[objId] = fPressure + fShear + ibObj->rho * g * ibObj->shape().area();
 
             //            std::cout << "Pressure force = " << fPressure << "\n"
             //                      << "Shear force = " << fShear << "\n"
             //                      << "Weight = " << ibObj->rho * g * ibObj->shape().area() << "\n"
-            //                      << "Net force = " << force << "\n";
+            //                      << "Net force = " << forces[objId] << "\n";
         }
 
-        ibObj->applyForce(grid_->comm().broadcast(grid_->comm().mainProcNo(), force));
-    }
+    grid_->comm().broadcast(grid_->comm().mainProcNo(), forces);
+
+    for(int objId = 0; objId < ibObjs_.size(); ++objId)
+        ibObjs_[objId]->applyForce(forces[objId]);
 }
 
 void DirectForcingImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho,
@@ -545,181 +459,49 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVol
                                                            const ScalarFiniteVolumeField &p,
                                                            const Vector2D &g)
 {
-    struct Stress
-    {
-        Point2D pt;
-        Scalar p;
-        Tensor2D tau;
-    };
-
-    for(auto &ibObj: ibObjs_)
-    {
-        CrsEquation eqn;
+    auto stresses = surfaceStresses([&rho](const Cell &cell) { return rho(cell); },
+                                    [&mu](const Cell &cell) { return mu(cell); },
+                                    u, p, g);
 
-        auto nLocalCells = grid_->comm().allGather(ibObj->ibCells().size());
+    std::vector<Vector2D> forces(ibObjs_.size(), Vector2D(0., 0.));
 
-        auto indexStart = 6 * std::accumulate(
-                    nLocalCells.begin(),
-                    nLocalCells.begin() + grid_->comm().rank(), 0);
-
-        auto cellIdToIndexMap = std::vector<Index>(grid_->cells().size(), -1);
-
-        Index ibCellId = 0;
-        for(const Cell& cell: ibObj->ibCells())
-            cellIdToIndexMap[cell.id()] = indexStart + 6 * ibCellId++;
-
-        grid_->sendMessages(cellIdToIndexMap);
-
-        std::vector<Stress> stresses;
-        stresses.reserve(ibObj->ibCells().size());
-
-        Index row = 0;
-        for(const Cell &cell: ibObj->ibCells())
+    //- Integrate the stresses
+    if(grid_->comm().isMainProc())
+        for(int objId = 0; objId < ibObjs_.size(); ++objId)
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, *this);
-
-            //- Compute the stress tensor
-            Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
-
-            int i = 0;
-            for(const Cell *cell: st.cells())
-            {
-                Point2D x = cell->centroid();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {u(*cell).x, u(*cell).y});
-            }
-
-            for(const auto &compatPt: st.compatPts())
-            {
-                Point2D x = compatPt.pt();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {compatPt.velocity().x, compatPt.velocity().y});
-            }
-
-            Point2D xb = ibObj->nearestIntersect(cell.centroid());
-            auto coeffs = solve(A, rhs);
-            auto derivs = Matrix(2, 6, {
-                                     2. * xb.x, 0., xb.y, 1., 0., 0.,
-                                     0., 2. * xb.y, xb.x, 0., 1., 0.
-                                 }) * coeffs;
-
-            //- The tensor is tranposed here
-            auto tau = Tensor2D(derivs(0, 0), derivs(1, 0), derivs(0, 1), derivs(1, 1));
-            tau = mu(cell) * (tau + tau.transpose());
-
-            stresses.push_back(Stress{xb, 0., tau});
-
-            auto divTau = mu(cell) * Vector2D(4 * coeffs(0, 0) + 2 * coeffs(1, 0) + coeffs(2, 1),
-                                              2 * coeffs(0, 1) + 4 * coeffs(1, 1) + coeffs(2, 0));
-
-            eqn.setRank(eqn.rank() + st.nReconstructionPoints());
-
-            Index colStart = cellIdToIndexMap[cell.id()];
-            for(const Cell *cell: st.cells())
-            {
-                Point2D x = cell->centroid();
-
-                eqn.setCoeffs(row,
-                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-
-                eqn.setRhs(row++, -p(*cell));
-            }
-
-            for(const auto &compatPt: st.compatPts())
-            {
-                if(&cell == &compatPt.cell())
-                    continue;
-
-                Point2D x = compatPt.pt();
-
-                eqn.setCoeffs(row,
-                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-
-                Index colStart2 = cellIdToIndexMap[compatPt.cell().id()];
-
-                eqn.setCoeffs(row++,
-                {colStart2, colStart2 + 1, colStart2 + 2, colStart2 + 3, colStart2 + 4, colStart2 + 5},
-                {-x.x * x.x, -x.y * x.y, -x.x * x.y, -x.x, -x.y, -1.});
-            }
-
-            Vector2D n = ibObj->nearestEdgeUnitNormal(xb);
-
-            eqn.setCoeffs(row,
-            {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
-            {2. * xb.x * n.x, 2. * xb.y * n.y, xb.y * n.x + xb.x * n.y, n.x, n.y, 0.});
-
-            eqn.setRhs(row++, rho(cell) * dot(ibObj->acceleration(xb), n) - dot(divTau, n));
-        }
-
-        eqn.setSparseSolver(std::make_shared<TrilinosAmesosSparseMatrixSolver>(grid_->comm(), Tpetra::DynamicProfile));
-        eqn.setRank(eqn.rank(), 6 * ibObj->ibCells().size());
-        eqn.solveLeastSquares();
-
-        //- Extract the pressure coeffs and compute
-        for(int i = 0; i < 6 * ibObj->ibCells().size(); i += 6)
-        {
-            Scalar a = eqn.x(i);
-            Scalar b = eqn.x(i + 1);
-            Scalar c = eqn.x(i + 2);
-            Scalar d = eqn.x(i + 3);
-            Scalar e = eqn.x(i + 4);
-            Scalar f = eqn.x(i + 5);
-
-            const Cell &cell = ibObj->ibCells()[i / 6];
-
-            Stress &stress = stresses[i / 6];
-            Point2D xb = stress.pt;
-            stress.p = a * xb.x * xb.x + b * xb.y * xb.y + c * xb.x * xb.y + d * xb.x + e * xb.y + f + rho(cell) * dot(xb, g);
-        }
-
-        stresses = grid_->comm().gatherv(grid_->comm().mainProcNo(), stresses);
-
-        Vector2D force(0., 0.);
-
-        //- Integrate the stresses
-        if(grid_->comm().isMainProc())
-        {
-
-            std::sort(stresses.begin(), stresses.end(), [&ibObj](const Stress &lhs, const Stress &rhs)
-            {
-                return (lhs.pt - ibObj->shape().centroid()).angle()
-                        < (rhs.pt - ibObj->shape().centroid()).angle();
-            });
+            const auto &ibObj = ibObjs_[objId];
+            const auto &objStresses = stresses[objId];
 
             Vector2D fShear(0., 0.), fPressure(0., 0.);
 
-            for(int i = 0; i < stresses.size(); ++i)
+            for(int i = 0; i < objStresses.size(); ++i)
             {
-                auto qpa = stresses[i];
-                auto qpb = stresses[(i + 1) % stresses.size()];
-
-                auto ptA = qpa.pt;
-                auto ptB = qpb.pt;
-                auto pA = qpa.p;
-                auto pB = qpb.p;
-                auto tauA = qpa.tau;
-                auto tauB = qpb.tau;
+                const auto &qpa = objStresses[i];
+                const auto &qpb = objStresses[(i + 1) % objStresses.size()];
 
-                fPressure += (pA + pB) / 2. * (ptA - ptB).normalVec();
-                fShear += dot((tauA + tauB) / 2., (ptB - ptA).normalVec());
+                fPressure += (qpa.p + qpb.p) / 2. * (qpa.pt - qpb.pt).normalVec();
+                fShear += dot((qpa.tau + qpb.tau) / 2., (qpb.pt - qpa.pt).normalVec());
             }
 
-            force = fPressure + fShear + ibObj->rho * g * ibObj->shape().area();
+            forces[objId] = fPressure + fShear + ibObj->rho * g * ibObj->shape().area();
 
             std::cout << "Pressure force = " << fPressure << "\n"
                       << "Shear force = " << fShear << "\n"
                       << "Weight = " << ibObj->rho * g * ibObj->shape().area() << "\n"
-                      << "Net force = " << force << "\n";
+                      << "Net force = " << forces[objId] << "\n";
         }
 
-        ibObj->applyForce(grid_->comm().broadcast(grid_->comm().mainProcNo(), force));
-    }
+    grid_->comm().broadcast(grid_->comm().mainProcNo(), forces);
+
+    for(int objId = 0; objId < ibObjs_.size(); ++objId)
+        ibObjs_[objId]->applyForce(forces[objId]);
 }
 
 void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho, const VectorFiniteVolumeField &fib, const Vector2D &g)
 {
+    std::vector<Vector2D> forces;
+    forces.reserve(ibObjs_.size());
+
     for(const auto &ibObj: ibObjs_)
     {
         Vector2D f = Vector2D(0., 0.);
@@ -727,9 +509,15 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(Scalar rho, const Vec
         for(const Cell &c: ibObj->cells())
             f -= rho * fib(c) * c.volume();
 
-        f = grid_->comm().sum(f);
-        f += (ibObj->rho - rho) * g * ibObj->shape().area();
-        ibObj->applyForce(f);
+        forces.push_back(f);
+    }
+
+    forces = grid_->comm().sum(forces);
+
+    for(int objId = 0; objId < ibObjs_.size(); ++objId)
+    {
+        const auto &ibObj = ibObjs_[objId];
+        ibObj->applyForce(forces[objId] + (ibObj->rho - rho) * g * ibObj->shape().area());
     }
 }
 
@@ -925,3 +713,327 @@ void DirectForcingImmersedBoundary::applyHydrodynamicForce(const VectorFiniteVol
 
 //    force_ = grid_->comm().broadcast(grid_->comm().mainProcNo(), force_);
 //}
+
+void DirectForcingImmersedBoundary::updateStencils()
+{
+    //- Stencils built on a previous grid revision refer to cells that no longer exist
+    if(stencilsRevision_ != grid_->revision())
+    {
+        stencils_.clear();
+        stencilsRevision_ = grid_->revision();
+    }
+
+    stencils_.resize(grid_->cells().size());
+
+    std::vector<std::shared_ptr<const LeastSquaresQuadraticStencil>> stencils(grid_->cells().size());
+    std::vector<Ref<const Cell>> ibCells(localIbCells_.begin(), localIbCells_.end());
+    std::string error;
+
+    //- Stencils are independent, so they and their factorizations can be built concurrently
+    #pragma omp parallel for
+    for(int i = 0; i < (int)ibCells.size(); ++i)
+    {
+        const Cell &cell = ibCells[i];
+        const auto &stencil = stencils_[cell.id()];
+
+        try
+        {
+            stencils[cell.id()] = stencil && stencil->isCurrent(cell, *this) ?
+                        stencil : std::make_shared<LeastSquaresQuadraticStencil>(cell, *this);
+        }
+        catch(const Exception &e)
+        {
+            #pragma omp critical
+            error = e.what();
+        }
+    }
+
+    stencils_.swap(stencils);
+
+    if(!error.empty())
+        throw Exception("DirectForcingImmersedBoundary", "updateStencils", error);
+}
+
+void DirectForcingImmersedBoundary::updateClusters()
+{
+    ibCellRows_.assign(grid_->cells().size(), -1);
+
+    Index nRows = 0;
+    for(const Cell &cell: localIbCells_)
+        ibCellRows_[cell.id()] = nRows++;
+
+    //- Union-find over the stencil couplings between local ib cells
+    std::vector<Index> roots(nRows);
+    std::iota(roots.begin(), roots.end(), 0);
+
+    auto root = [&roots](Index i)
+    {
+        while(roots[i] != i)
+            i = roots[i] = roots[roots[i]];
+        return i;
+    };
+
+    long remote = 0;
+    for(const Cell &cell: localIbCells_)
+        for(const Cell *stCell: stencil(cell).cells())
+        {
+            Index j = ibCellRows_[stCell->id()];
+
+            if(j != -1)
+                roots[root(ibCellRows_[cell.id()])] = root(j);
+            else if((*cellStatus_)(*stCell) == IB_CELLS)
+                remote = 1;
+        }
+
+    remoteIbCoupling_ = grid_->comm().sum(remote) > 0;
+
+    std::vector<Index> clusterNos(nRows, -1);
+    ibClusters_.clear();
+    ibClusterPositions_.resize(nRows);
+
+    for(Index i = 0; i < nRows; ++i)
+    {
+        Index r = root(i);
+
+        if(clusterNos[r] == -1)
+        {
+            clusterNos[r] = ibClusters_.size();
+            ibClusters_.emplace_back();
+        }
+
+        std::vector<Index> &cluster = ibClusters_[clusterNos[r]];
+        ibClusterPositions_[i] = cluster.size();
+        cluster.push_back(i);
+    }
+}
+
+void DirectForcingImmersedBoundary::solveIbCellSystem(const std::vector<IbCellRow> &rows,
+                                                      VectorFiniteVolumeField &x) const
+{
+    std::vector<Ref<const Cell>> ibCells(localIbCells_.begin(), localIbCells_.end());
+
+    //- Clusters split across processes are coupled by iterating over the exchanged buffer values
+    const int maxIters = 100;
+    const Scalar tolerance = 1e-10;
+
+    for(int iter = 0;; ++iter)
+    {
+        Scalar maxChange = 0., maxValue = 0.;
+
+        #pragma omp parallel for reduction(max: maxChange, maxValue)
+        for(int k = 0; k < (int)ibClusters_.size(); ++k)
+        {
+            const std::vector<Index> &cluster = ibClusters_[k];
+
+            std::vector<SparseEntry> entries;
+            Vector rhs(2 * cluster.size());
+
+            for(Index p = 0; p < cluster.size(); ++p)
+            {
+                const IbCellRow &r = rows[cluster[p]];
+                Vector2D b = -r.src;
+
+                entries.emplace_back(2 * p, 2 * p, r.diag.xx);
+                entries.emplace_back(2 * p, 2 * p + 1, r.diag.xy);
+                entries.emplace_back(2 * p + 1, 2 * p, r.diag.yx);
+                entries.emplace_back(2 * p + 1, 2 * p + 1, r.diag.yy);
+
+                for(int i = 0; i < r.cells.size(); ++i)
+                {
+                    Index j = ibCellRows_[r.cells[i]->id()];
+
+                    if(j != -1)
+                    {
+                        Index q = ibClusterPositions_[j];
+                        entries.emplace_back(2 * p, 2 * q, r.coeffs[i]);
+                        entries.emplace_back(2 * p + 1, 2 * q + 1, r.coeffs[i]);
+                    }
+                    else
+                        b -= r.coeffs[i] * x(*r.cells[i]);
+                }
+
+                rhs(2 * p) = b.x;
+                rhs(2 * p + 1) = b.y;
+            }
+
+            EigenSparseMatrixSolver solver;
+            solver.setRank(rhs.size());
+            solver.set(entries);
+            solver.setRhs(rhs);
+            solver.solve();
+
+            for(Index p = 0; p < cluster.size(); ++p)
+            {
+                Vector2D &xc = x(ibCells[cluster[p]]);
+                Vector2D xNew(solver.x(2 * p), solver.x(2 * p + 1));
+
+                maxChange = std::max(maxChange, (xNew - xc).mag());
+                maxValue = std::max(maxValue, xNew.mag());
+                xc = xNew;
+            }
+        }
+
+        x.sendMessages();
+
+        if(!remoteIbCoupling_)
+            break;
+
+        Scalar change = grid_->comm().max(maxValue > 0. ? maxChange / maxValue : 0.);
+
+        if(change <= tolerance)
+            break;
+
+        if(iter == maxIters)
+        {
+            grid_->comm().printf("Warning: ib cell coupling across processes did not converge in %d iterations, "
+                                 "relative change = %e.\n", maxIters, change);
+            break;
+        }
+    }
+}
+
+std::vector<std::vector<DirectForcingImmersedBoundary::SurfaceStress>>
+DirectForcingImmersedBoundary::surfaceStresses(const std::function<Scalar(const Cell&)> &rho,
+                                               const std::function<Scalar(const Cell&)> &mu,
+                                               const VectorFiniteVolumeField &u,
+                                               const ScalarFiniteVolumeField &p,
+                                               const Vector2D &g) const
+{
+    //- The ib cells of all objects are numbered contiguously, so every object shares one index map and one system
+    Size nLocalIbCells = 0;
+    for(const auto &ibObj: ibObjs_)
+        nLocalIbCells += ibObj->ibCells().size();
+
+    auto nLocalCells = grid_->comm().allGather(nLocalIbCells);
+
+    auto indexStart = 6 * std::accumulate(
+                nLocalCells.begin(),
+                nLocalCells.begin() + grid_->comm().rank(), 0);
+
+    auto cellIdToIndexMap = std::vector<Index>(grid_->cells().size(), -1);
+
+    Index ibCellId = 0;
+    for(const auto &ibObj: ibObjs_)
+        for(const Cell& cell: ibObj->ibCells())
+            cellIdToIndexMap[cell.id()] = indexStart + 6 * ibCellId++;
+
+    grid_->sendMessages(cellIdToIndexMap);
+
+    std::vector<SurfaceStress> stresses;
+    stresses.reserve(nLocalIbCells);
+
+    CrsEquation eqn;
+
+    Index row = 0;
+    for(Index objId = 0; objId < ibObjs_.size(); ++objId)
+    {
+        const auto &ibObj = ibObjs_[objId];
+
+        for(const Cell &cell: ibObj->ibCells())
+        {
+            const auto &st = stencil(cell);
+
+            //- Compute the stress tensor
+            Point2D xb = ibObj->nearestIntersect(cell.centroid());
+            auto coeffs = st.velocityFitCoeffs(u);
+
+            //- The tensor is tranposed here
+            auto tau = Tensor2D(2. * xb.x * coeffs(0, 0) + xb.y * coeffs(2, 0) + coeffs(3, 0),
+                                2. * xb.y * coeffs(1, 0) + xb.x * coeffs(2, 0) + coeffs(4, 0),
+                                2. * xb.x * coeffs(0, 1) + xb.y * coeffs(2, 1) + coeffs(3, 1),
+                                2. * xb.y * coeffs(1, 1) + xb.x * coeffs(2, 1) + coeffs(4, 1));
+            tau = mu(cell) * (tau + tau.transpose());
+
+            stresses.push_back(SurfaceStress{objId, xb, 0., tau});
+
+            auto divTau = mu(cell) * Vector2D(4 * coeffs(0, 0) + 2 * coeffs(1, 0) + coeffs(2, 1),
+                                              2 * coeffs(0, 1) + 4 * coeffs(1, 1) + coeffs(2, 0));
+
+            eqn.addRows(st.nReconstructionPoints(), 12);
+
+            Index colStart = cellIdToIndexMap[cell.id()];
+            for(const Cell *cell: st.cells())
+            {
+                Point2D x = cell->centroid();
+
+                eqn.setCoeffs(row,
+                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
+                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+
+                eqn.setRhs(row++, -p(*cell));
+            }
+
+            for(const auto &compatPt: st.compatPts())
+            {
+                if(&cell == &compatPt.cell())
+                    continue;
+
+                Point2D x = compatPt.pt();
+
+                eqn.setCoeffs(row,
+                {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
+                {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+
+                Index colStart2 = cellIdToIndexMap[compatPt.cell().id()];
+
+                eqn.setCoeffs(row++,
+                {colStart2, colStart2 + 1, colStart2 + 2, colStart2 + 3, colStart2 + 4, colStart2 + 5},
+                {-x.x * x.x, -x.y * x.y, -x.x * x.y, -x.x, -x.y, -1.});
+            }
+
+            Vector2D n = ibObj->nearestEdgeUnitNormal(xb);
+
+            eqn.setCoeffs(row,
+            {colStart, colStart + 1, colStart + 2, colStart + 3, colStart + 4, colStart + 5},
+            {2. * xb.x * n.x, 2. * xb.y * n.y, xb.y * n.x + xb.x * n.y, n.x, n.y, 0.});
+
+            eqn.setRhs(row++, rho(cell) * dot(ibObj->acceleration(xb), n) - dot(divTau, n));
+        }
+    }
+
+    eqn.setSparseSolver(std::make_shared<TrilinosAmesosSparseMatrixSolver>(grid_->comm(), Tpetra::DynamicProfile));
+    eqn.setRank(eqn.rank(), 6 * nLocalIbCells);
+    eqn.solveLeastSquares();
+
+    //- Extract the pressure coeffs and compute
+    ibCellId = 0;
+    for(const auto &ibObj: ibObjs_)
+        for(const Cell &cell: ibObj->ibCells())
+        {
+            Index i = 6 * ibCellId;
+            Scalar a = eqn.x(i);
+            Scalar b = eqn.x(i + 1);
+            Scalar c = eqn.x(i + 2);
+            Scalar d = eqn.x(i + 3);
+            Scalar e = eqn.x(i + 4);
+            Scalar f = eqn.x(i + 5);
+
+            SurfaceStress &stress = stresses[ibCellId++];
+            Point2D xb = stress.pt;
+            stress.p = a * xb.x * xb.x + b * xb.y * xb.y + c * xb.x * xb.y + d * xb.x + e * xb.y + f + rho(cell) * dot(xb, g);
+        }
+
+    stresses = grid_->comm().gatherv(grid_->comm().mainProcNo(), stresses);
+
+    std::vector<std::vector<SurfaceStress>> objStresses;
+
+    if(grid_->comm().isMainProc())
+    {
+        objStresses.resize(ibObjs_.size());
+
+        for(const SurfaceStress &stress: stresses)
+            objStresses[stress.ibObjId].push_back(stress);
+
+        for(Index objId = 0; objId < ibObjs_.size(); ++objId)
+        {
+            Point2D xc = ibObjs_[objId]->shape().centroid();
+
+            std::sort(objStresses[objId].begin(), objStresses[objId].end(), [&xc](const SurfaceStress &lhs, const SurfaceStress &rhs)
+            {
+                return (lhs.pt - xc).angle() < (rhs.pt - xc).angle();
+            });
+        }
+    }
+
+    return objStresses;
+}
@@ -1,9 +1,12 @@
 #ifndef PHASE_DIRECT_FORCING_IMMERSED_BOUNDARY_H
 #define PHASE_DIRECT_FORCING_IMMERSED_BOUNDARY_H
 
+#include <functional>
+
 #include "Geometry/Tensor2D.h"
 #include "Math/StaticMatrix.h"
 #include "Math/Matrix.h"
+#include "System/StaticVector.h"
 
 #include "ImmersedBoundary.h"
 
@@ -20,9 +23,11 @@ public:
 
     void updateCells() override;
 
-    FiniteVolumeEquation<Vector2D> computeForcingTerm(const VectorFiniteVolumeField &u,
-                                                      Scalar timeStep,
-                                                      VectorFiniteVolumeField &fib) const;
+    //- Solves for the forcing term. Fluid and solid cells are set explicitly, only the ib cells are coupled
+    void solveForcingTerm(const VectorFiniteVolumeField &u, Scalar timeStep, VectorFiniteVolumeField &fib) const;
+
+    //- Extends the pressure gradient into the ib cells, the other cells are left unchanged
+    void extendPressureGradient(VectorFiniteVolumeField &gradP) const;
 
     virtual FiniteVolumeEquation<Scalar> bcs(ScalarFiniteVolumeField &phi) const
     { return FiniteVolumeEquation<Scalar>(phi); }
@@ -62,6 +67,9 @@ public:
     const CellGroup &localSolidCells() const
     { return localSolidCells_; }
 
+    //- Reconstruction stencil of a local ib cell, valid until the next call to updateCells
+    const LeastSquaresQuadraticStencil &stencil(const Cell &cell) const;
+
     //    const CellGroup &globalIbCells() const
     //    { return globalIbCells_; }
 
@@ -70,8 +78,64 @@ public:
 
 private:
 
+    //- Row of a system coupling the local ib cells, diag * x(cell) + sum(coeffs[i] * x(cells[i])) + src = 0
+    struct IbCellRow
+    {
+        Tensor2D diag;
+
+        StaticVector<const Cell*, 8> cells;
+
+        StaticVector<Scalar, 8> coeffs;
+
+        Vector2D src;
+    };
+
+    //- Reconstructed surface pressure and viscous stress at the boundary point of an ib cell
+    struct SurfaceStress
+    {
+        Index ibObjId;
+
+        Point2D pt;
+
+        Scalar p;
+
+        Tensor2D tau;
+    };
+
+    //- Rebuilds the stencils of the ib cells whose reconstruction points changed, the others keep their factorizations
+    void updateStencils();
+
+    //- Reconstructs the surface stresses of all ib objects with one least-squares solve. The result is gathered on
+    //- the main process, one list per ib object sorted by angle about its centroid, and is empty elsewhere
+    std::vector<std::vector<SurfaceStress>> surfaceStresses(const std::function<Scalar(const Cell&)> &rho,
+                                                            const std::function<Scalar(const Cell&)> &mu,
+                                                            const VectorFiniteVolumeField &u,
+                                                            const ScalarFiniteVolumeField &p,
+                                                            const Vector2D &g) const;
+
+    void updateClusters();
+
+    //- Solves each cluster directly, values of x outside the local ib cells are treated as known
+    void solveIbCellSystem(const std::vector<IbCellRow> &rows, VectorFiniteVolumeField &x) const;
+
     CellGroup localIbCells_, localSolidCells_;
 
+    std::vector<std::shared_ptr<const LeastSquaresQuadraticStencil>> stencils_;
+
+    //- Grid revision the stencils were built on
+    Size stencilsRevision_ = 0;
+
+    //- Row of each local ib cell, in the order of localIbCells_, and the rows of each cluster of ib cells
+    //- connected through their stencils
+    std::vector<Index> ibCellRows_;
+
+    std::vector<std::vector<Index>> ibClusters_;
+
+    std::vector<Index> ibClusterPositions_;
+
+    //- Whether any stencil reaches an ib cell on another process, in which case the clusters are iterated
+    bool remoteIbCoupling_ = false;
+
     CellGroup globalIbCells_, globalSolidCells_;
 };
 
@@ -1,7 +1,5 @@
 #include "DirectForcingImmersedBoundaryLeastSquaresQuadraticStencil.h"
 
-std::vector<std::vector<const ImmersedBoundaryObject*>> DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_ibObjSets(2);
-
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_A;
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_b;
@@ -9,18 +7,53 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::_b;
 DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadraticStencil(const Cell &cell,
                                                                                           const DirectForcingImmersedBoundary &ib)
 {
-    _ibObjSets[0].clear();
+    findReconstructionPoints(cell, ib, _cells, _faces, _compatPts);
+
+    if(nReconstructionPoints() < 2)
+        throw Exception("DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil",
+                        "LeastSquaresQuadraticStencil",
+                        "Could not locate enough reconstruction points. Points found = "
+                        + std::to_string(nReconstructionPoints()) + "."
+                        + " Num cells = " + std::to_string(_cells.size())
+                        + ", Num compat pts = " + std::to_string(_compatPts.size()) + ".");
+
+    initFactorizations();
+}
+
+bool DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::isCurrent(const Cell &cell,
+                                                                          const DirectForcingImmersedBoundary &ib) const
+{
+    StaticVector<const Cell*, 8> cells;
+    StaticVector<const Face*, 8> faces;
+    StaticVector<CompatPoint, 8> compatPts;
+
+    findReconstructionPoints(cell, ib, cells, faces, compatPts);
+
+    return cells.size() == _cells.size() && std::equal(cells.begin(), cells.end(), _cells.begin())
+            && faces.size() == _faces.size() && std::equal(faces.begin(), faces.end(), _faces.begin())
+            && compatPts.size() == _compatPts.size() && std::equal(compatPts.begin(), compatPts.end(), _compatPts.begin());
+}
+
+void DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::findReconstructionPoints(const Cell &cell,
+                                                                                         const DirectForcingImmersedBoundary &ib,
+                                                                                         StaticVector<const Cell*, 8> &cells,
+                                                                                         StaticVector<const Face*, 8> &faces,
+                                                                                         StaticVector<CompatPoint, 8> &compatPts)
+{
+    //- Kept local so that stencils can be constructed concurrently
+    StaticVector<const ImmersedBoundaryObject*, 8> ibObjSets[2];
+
     for(const CellLink &nb: cell.neighbours())
     {
         auto ibObj = ib.ibObj(nb.cell());
 
-        if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) == _ibObjSets[0].end())
+        if(ibObj && std::find(ibObjSets[0].begin(), ibObjSets[0].end(), ibObj.get()) == ibObjSets[0].end())
         {
-            _compatPts.push_back(CompatPoint(cell, *ibObj));
-            _ibObjSets[0].emplace_back(ibObj.get());
+            compatPts.push_back(CompatPoint(cell, *ibObj));
+            ibObjSets[0].push_back(ibObj.get());
         }
         else
-            _cells.push_back(&nb.cell());
+            cells.push_back(&nb.cell());
     }
 
     for(const CellLink &nb: cell.diagonals())
@@ -28,29 +61,29 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
         auto ibObj = ib.ibObj(nb.cell());
 
         if(!ibObj)
-            _cells.push_back(&nb.cell());
+            cells.push_back(&nb.cell());
     }
 
     for(const BoundaryLink &bd: cell.boundaries())
     {
         auto ibObj = ib.ibObj(bd.face().centroid());
         if(!ibObj)
-            _faces.push_back(&bd.face());
+            faces.push_back(&bd.face());
     }
 
-    for(const Cell *stCell: _cells)
+    for(const Cell *stCell: cells)
     {
-        _ibObjSets[1].clear();
+        ibObjSets[1].clear();
 
         for(const CellLink &nb: stCell->neighbours())
         {
             auto ibObj = ib.ibObj(nb.cell());
 
-            if(ibObj && std::find(_ibObjSets[0].begin(), _ibObjSets[0].end(), ibObj.get()) != _ibObjSets[0].end()
-                    && std::find(_ibObjSets[1].begin(), _ibObjSets[1].end(), ibObj.get()) == _ibObjSets[1].end())
+            if(ibObj && std::find(ibObjSets[0].begin(), ibObjSets[0].end(), ibObj.get()) != ibObjSets[0].end()
+                    && std::find(ibObjSets[1].begin(), ibObjSets[1].end(), ibObj.get()) == ibObjSets[1].end())
             {
-                _compatPts.push_back(CompatPoint(*stCell, *ibObj));
-                _ibObjSets[1].emplace_back(ibObj.get());
+                compatPts.push_back(CompatPoint(*stCell, *ibObj));
+                ibObjSets[1].push_back(ibObj.get());
             }
         }
 
@@ -58,17 +91,9 @@ DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::LeastSquaresQuadrat
         {
             auto ibObj = ib.ibObj(bd.face().centroid());
             if(!ibObj)
-                _faces.push_back(&bd.face());
+                faces.push_back(&bd.face());
         }
     }
-
-    if(nReconstructionPoints() < 2)
-        throw Exception("DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil",
-                        "LeastSquaresQuadraticStencil",
-                        "Could not locate enough reconstruction points. Points found = "
-                        + std::to_string(nReconstructionPoints()) + "."
-                        + " Num cells = " + std::to_string(_cells.size())
-                        + ", Num compat pts = " + std::to_string(_compatPts.size()) + ".");
 }
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::interpolationCoeffs(const Point2D &x) const
@@ -88,6 +113,14 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::continuityCo
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterpolationCoeffs(const Point2D &x) const
 {
+    if(_linearFit.isFactorized())
+    {
+        Scalar c[] = {x.x, x.y, 1.};
+        Matrix beta(1, nReconstructionPoints());
+        _linearFit.coeffs(c, beta.data());
+        return beta;
+    }
+
     _A.resize(nReconstructionPoints(), 3);
 
     int i = 0;
@@ -118,6 +151,14 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::linearInterp
 
 Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::quadraticInterpolationCoeffs(const Point2D &x) const
 {
+    if(_quadraticFit.isFactorized())
+    {
+        Scalar c[] = {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.};
+        Matrix beta(1, nReconstructionPoints());
+        _quadraticFit.coeffs(c, beta.data());
+        return beta;
+    }
+
     _A.resize(nReconstructionPoints(), 6);
 
     int i = 0;
@@ -235,3 +276,84 @@ Matrix DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::polarQuadrat
 
     return _b * _A;
 }
+
+StaticMatrix<6, 2> DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::velocityFitCoeffs(const VectorFiniteVolumeField &u) const
+{
+    Scalar rhs[16 * 2];
+
+    int i = 0;
+    for(const Cell *cell: _cells)
+    {
+        rhs[i++] = u(*cell).x;
+        rhs[i++] = u(*cell).y;
+    }
+
+    for(const CompatPoint &cpt: _compatPts)
+    {
+        Vector2D vel = cpt.velocity();
+        rhs[i++] = vel.x;
+        rhs[i++] = vel.y;
+    }
+
+    if(_velocityFit.isFactorized())
+        return _velocityFit.solve<2>(rhs);
+
+    //- Under-determined or rank deficient, fall back to the minimum norm solution. The solution overwrites b, which
+    //- needs at least six rows when there are fewer points than coefficients
+    Size m = _cells.size() + _compatPts.size();
+    Matrix A(m, 6), b(std::max(m, Size(6)), 2);
+    std::copy(rhs, rhs + 2 * m, b.data());
+
+    i = 0;
+    for(const Cell *cell: _cells)
+    {
+        const Point2D &x = cell->centroid();
+        A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+    }
+
+    for(const CompatPoint &cpt: _compatPts)
+    {
+        const Point2D &x = cpt.pt();
+        A.setRow(i++, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+    }
+
+    Matrix coeffs = solve(A, b);
+    StaticMatrix<6, 2> result;
+    std::copy(coeffs.data(), coeffs.data() + 12, result.data());
+
+    return result;
+}
+
+void DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil::initFactorizations()
+{
+    //- Rows are ordered cells, compatibility points then faces, matching the coefficient ordering
+    for(const Cell *cell: _cells)
+    {
+        const Point2D &x = cell->centroid();
+        _linearFit.addRow({x.x, x.y, 1.});
+        _quadraticFit.addRow({x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        _velocityFit.addRow({x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+    }
+
+    for(const CompatPoint &cpt: _compatPts)
+    {
+        const Point2D &x = cpt.pt();
+        _linearFit.addRow({x.x, x.y, 1.});
+        _quadraticFit.addRow({x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+        _velocityFit.addRow({x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+    }
+
+    for(const Face *face: _faces)
+    {
+        const Point2D &x = face->centroid();
+        _linearFit.addRow({x.x, x.y, 1.});
+        _quadraticFit.addRow({x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
+    }
+
+    if(nReconstructionPoints() >= 6)
+        _quadraticFit.factorize();
+    else if(nReconstructionPoints() >= 3)
+        _linearFit.factorize();
+
+    _velocityFit.factorize();
+}
@@ -2,6 +2,7 @@
 #define PHASE_DIRECT_FORCING_IMMERSED_BOUNDARY_LEAST_SQUARES_QUADRATIC_STENCIL_H
 
 #include "System/StaticVector.h"
+#include "Math/StaticLeastSquares.h"
 
 #include "DirectForcingImmersedBoundary.h"
 
@@ -35,6 +36,9 @@ public:
         const Point2D &pt() const
         { return _pt; }
 
+        bool operator==(const CompatPoint &rhs) const
+        { return _cell == rhs._cell && _ibObj == rhs._ibObj && _pt == rhs._pt; }
+
         Vector2D ns() const
         { return _ibObj->nearestEdgeUnitNormal(_pt); }
 
@@ -50,6 +54,10 @@ public:
     LeastSquaresQuadraticStencil(const Cell &cell,
                                  const DirectForcingImmersedBoundary &ib);
 
+    //- True if a stencil built for cell now would have the same reconstruction points, so the factorizations still
+    //- hold. Covers changes of the ib cells around cell and moving ib objects
+    bool isCurrent(const Cell &cell, const DirectForcingImmersedBoundary &ib) const;
+
     Size nReconstructionPoints() const
     { return _cells.size() + _faces.size() + _compatPts.size(); }
 
@@ -69,12 +77,21 @@ public:
 
     Matrix polarQuadraticContinuityConstrainedInterpolationCoeffs(const Point2D &x) const;
 
-protected:
+    //- Quadratic least-squares coefficients of u fitted to the stencil cells and compatibility points
+    StaticMatrix<6, 2> velocityFitCoeffs(const VectorFiniteVolumeField &u) const;
 
-    static std::vector<std::vector<const ImmersedBoundaryObject*>> _ibObjSets;
+protected:
 
     static Matrix _A, _b;
 
+    static void findReconstructionPoints(const Cell &cell,
+                                         const DirectForcingImmersedBoundary &ib,
+                                         StaticVector<const Cell*, 8> &cells,
+                                         StaticVector<const Face*, 8> &faces,
+                                         StaticVector<CompatPoint, 8> &compatPts);
+
+    void initFactorizations();
+
     Matrix linearInterpolationCoeffs(const Point2D &x) const;
 
     Matrix quadraticInterpolationCoeffs(const Point2D &x) const;
@@ -88,6 +105,13 @@ protected:
     StaticVector<const Face*, 8> _faces;
 
     StaticVector<CompatPoint, 8> _compatPts;
+
+    //- Factorizations are computed once per stencil and reused for every evaluation
+    StaticLeastSquares<3, 24> _linearFit;
+
+    StaticLeastSquares<6, 24> _quadraticFit;
+
+    StaticLeastSquares<6, 16> _velocityFit;
 };
 
 #endif
@@ -33,24 +33,26 @@ void GhostCellImmersedBoundary::updateCells()
         domainCells_->remove(ibCells);
         domainCells_->remove(solidCells);
     }
+
+    stencilCaches_.clear();
 }
 
 FiniteVolumeEquation<Scalar> GhostCellImmersedBoundary::bcs(ScalarFiniteVolumeField &phi) const
 {
     FiniteVolumeEquation<Scalar> eqn(phi);
 
-    for(const auto &ibObj: ibObjs_)
+    for(Label i = 0; i < ibObjs_.size(); ++i)
     {
+        const auto &ibObj = ibObjs_[i];
         Scalar refVal = ibObj->bcRefValue<Scalar>(phi.name());
 
         switch(ibObj->bcType(phi.name()))
         {
         case ImmersedBoundaryObject::FIXED:
-            for(const Cell& cell: ibObj->ibCells())
+            for(const auto &st: fixedStencils(i))
             {
-                FixedBcStencil st = FixedBcStencil(cell, *ibObj, *grid_);
-                eqn.add(st.cell(), st.cells(), st.coeffs());
-                eqn.addSource(st.cell(), -refVal);
+                eqn.add(st->cell(), st->cells(), st->coeffs());
+                eqn.addSource(st->cell(), -refVal);
             }
 
             for(const Cell& cell: ibObj->solidCells())
@@ -61,11 +63,10 @@ FiniteVolumeEquation<Scalar> GhostCellImmersedBoundary::bcs(ScalarFiniteVolumeFi
 
             break;
         case ImmersedBoundaryObject::NORMAL_GRADIENT:
-            for(const Cell& cell: ibObj->ibCells())
+            for(const auto &st: normalGradientStencils(i))
             {
-                NormalGradientBcStencil st = NormalGradientBcStencil(cell, *ibObj, *grid_);
-                eqn.add(st.cell(), st.cells(), st.coeffs());
-                eqn.addSource(st.cell(), -refVal);
+                eqn.add(st->cell(), st->cells(), st->coeffs());
+                eqn.addSource(st->cell(), -refVal);
             }
 
             for(const Cell& cell: ibObj->solidCells())
@@ -87,13 +88,14 @@ FiniteVolumeEquation<Vector2D> GhostCellImmersedBoundary::velocityBcs(VectorFini
 {
     FiniteVolumeEquation<Vector2D> eqn(u);
 
-    for(const auto &ibObj: ibObjs_)
+    for(Label i = 0; i < ibObjs_.size(); ++i)
     {
-        for(const Cell& cell: ibObj->ibCells())
+        const auto &ibObj = ibObjs_[i];
+
+        for(const auto &st: fixedStencils(i))
         {
-            FixedBcStencil st = FixedBcStencil(cell, *ibObj, *grid_);
-            eqn.add(st.cell(), st.cells(), st.coeffs());
-            eqn.addSource(st.cell(), -ibObj->velocity(st.bp()));
+            eqn.add(st->cell(), st->cells(), st->coeffs());
+            eqn.addSource(st->cell(), -ibObj->velocity(st->bp()));
         }
 
         for(const Cell& cell: ibObj->solidCells())
@@ -114,56 +116,70 @@ void GhostCellImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                                        const ScalarFiniteVolumeField &p,
                                                        const Vector2D &g)
 {
-    std::vector<std::tuple<Point2D, Scalar, Scalar>> stresses;
+    //- Stresses of all objects are gathered together, tagged by object
+    std::vector<std::tuple<Label, Point2D, Scalar, Scalar>> stresses;
 
-    for(auto &ibObj: ibObjs_)
+    for(Label i = 0; i < ibObjs_.size(); ++i)
     {
-        for (const Cell& cell: ibObj->ibCells())
+        for (const auto &st: fixedStencils(i))
         {
-            FixedBcStencil st = FixedBcStencil(cell, *ibObj, *grid_);
-
             stresses.push_back(
                         std::make_tuple(
-                            st.bp(),
-                            st.bpValue(p) + rho * dot(st.bp(), g),
-                            mu * dot(dot(st.bpGrad(u), st.nw()), st.nw().tangentVec())
+                            i,
+                            st->bp(),
+                            st->bpValue(p) + rho * dot(st->bp(), g),
+                            mu * dot(dot(st->bpGrad(u), st->nw()), st->nw().tangentVec())
                             )
                         );
         }
+    }
 
-        stresses = grid_->comm().gatherv(grid_->comm().mainProcNo(), stresses);
+    stresses = grid_->comm().gatherv(grid_->comm().mainProcNo(), stresses);
 
-        auto force = Vector2D(0., 0.);
+    std::vector<Vector2D> forces(ibObjs_.size(), Vector2D(0., 0.));
 
-        if (grid_->comm().isMainProc())
+    if (grid_->comm().isMainProc())
+    {
+        std::vector<std::vector<std::tuple<Label, Point2D, Scalar, Scalar>>> objStresses(ibObjs_.size());
+
+        for (const auto &stress: stresses)
+            objStresses[std::get<0>(stress)].push_back(stress);
+
+        for(Label i = 0; i < ibObjs_.size(); ++i)
         {
-            std::sort(stresses.begin(), stresses.end(),
-                      [ibObj](const std::tuple<Point2D, Scalar, Scalar> &a, std::tuple<Point2D, Scalar, Scalar> &b)
+            const auto &ibObj = ibObjs_[i];
+            auto &ibStresses = objStresses[i];
+
+            std::sort(ibStresses.begin(), ibStresses.end(),
+                      [ibObj](const std::tuple<Label, Point2D, Scalar, Scalar> &a, const std::tuple<Label, Point2D, Scalar, Scalar> &b)
             {
-                return (std::get<0>(a) - ibObj->shape().centroid()).angle() <
-                        (std::get<0>(b) - ibObj->shape().centroid()).angle();
+                return (std::get<1>(a) - ibObj->shape().centroid()).angle() <
+                        (std::get<1>(b) - ibObj->shape().centroid()).angle();
             });
 
-            for (int i = 0; i < stresses.size(); ++i)
+            for (int j = 0; j < ibStresses.size(); ++j)
             {
-                const auto &a = stresses[i];
-                const auto &b = stresses[(i + 1) % stresses.size()];
+                const auto &a = ibStresses[j];
+                const auto &b = ibStresses[(j + 1) % ibStresses.size()];
 
-                const Point2D &ptA = std::get<0>(a);
-                const Point2D &ptB = std::get<0>(b);
-                Scalar prA = std::get<1>(a);
-                Scalar prB = std::get<1>(b);
-                Scalar shA = std::get<2>(a);
-                Scalar shB = std::get<2>(b);
+                const Point2D &ptA = std::get<1>(a);
+                const Point2D &ptB = std::get<1>(b);
+                Scalar prA = std::get<2>(a);
+                Scalar prB = std::get<2>(b);
+                Scalar shA = std::get<3>(a);
+                Scalar shB = std::get<3>(b);
 
-                force += -(prA + prB) / 2. * (ptB - ptA).normalVec() + (shA + shB) / 2. * (ptB - ptA);
+                forces[i] += -(prA + prB) / 2. * (ptB - ptA).normalVec() + (shA + shB) / 2. * (ptB - ptA);
             }
         }
+    }
 
-        force = grid_->comm().broadcast(grid_->comm().mainProcNo(), force);
-        ibObj->applyForce(force);
+    grid_->comm().broadcast(grid_->comm().mainProcNo(), forces);
 
-        std::cout << "Force = " << force << std::endl;
+    for(Label i = 0; i < ibObjs_.size(); ++i)
+    {
+        ibObjs_[i]->applyForce(forces[i]);
+        std::cout << "Force = " << forces[i] << std::endl;
     }
 }
 
@@ -175,3 +191,60 @@ void GhostCellImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeF
 {
     throw Exception("GhostCellImmersedBoundary", "applyHydrodynamicForce", "not implemented.");
 }
+
+//- Stencil caching
+
+GhostCellImmersedBoundary::StencilCache &GhostCellImmersedBoundary::stencilCache(Label ibObjNo) const
+{
+    stencilCaches_.resize(ibObjs_.size());
+
+    const ImmersedBoundaryObject &ibObj = *ibObjs_[ibObjNo];
+    StencilCache &cache = stencilCaches_[ibObjNo];
+
+    if (!(cache.position == ibObj.position()) || cache.theta != ibObj.theta() || cache.nIbCells != ibObj.ibCells().size())
+    {
+        cache.position = ibObj.position();
+        cache.theta = ibObj.theta();
+        cache.nIbCells = ibObj.ibCells().size();
+        cache.fixedStencils.clear();
+        cache.normalGradientStencils.clear();
+    }
+
+    return cache;
+}
+
+const std::vector<std::shared_ptr<const GhostCellImmersedBoundary::FixedBcStencil>> &
+GhostCellImmersedBoundary::fixedStencils(Label ibObjNo) const
+{
+    StencilCache &cache = stencilCache(ibObjNo);
+    const ImmersedBoundaryObject &ibObj = *ibObjs_[ibObjNo];
+
+    if (cache.fixedStencils.size() != ibObj.ibCells().size())
+    {
+        cache.fixedStencils.clear();
+        cache.fixedStencils.reserve(ibObj.ibCells().size());
+
+        for(const Cell &cell: ibObj.ibCells())
+            cache.fixedStencils.push_back(std::make_shared<FixedBcStencil>(cell, ibObj, *grid_));
+    }
+
+    return cache.fixedStencils;
+}
+
+const std::vector<std::shared_ptr<const GhostCellImmersedBoundary::NormalGradientBcStencil>> &
+GhostCellImmersedBoundary::normalGradientStencils(Label ibObjNo) const
+{
+    StencilCache &cache = stencilCache(ibObjNo);
+    const ImmersedBoundaryObject &ibObj = *ibObjs_[ibObjNo];
+
+    if (cache.normalGradientStencils.size() != ibObj.ibCells().size())
+    {
+        cache.normalGradientStencils.clear();
+        cache.normalGradientStencils.reserve(ibObj.ibCells().size());
+
+        for(const Cell &cell: ibObj.ibCells())
+            cache.normalGradientStencils.push_back(std::make_shared<NormalGradientBcStencil>(cell, ibObj, *grid_));
+    }
+
+    return cache.normalGradientStencils;
+}
@@ -39,6 +39,27 @@ public:
 
 protected:
 
+    //- Stencils of one ib object, reused until the object moves or its ib cells change
+    struct StencilCache
+    {
+        Vector2D position;
+
+        Scalar theta = 0.;
+
+        Size nIbCells = 0;
+
+        std::vector<std::shared_ptr<const FixedBcStencil>> fixedStencils;
+
+        std::vector<std::shared_ptr<const NormalGradientBcStencil>> normalGradientStencils;
+    };
+
+    StencilCache &stencilCache(Label ibObjNo) const;
+
+    const std::vector<std::shared_ptr<const FixedBcStencil>> &fixedStencils(Label ibObjNo) const;
+
+    const std::vector<std::shared_ptr<const NormalGradientBcStencil>> &normalGradientStencils(Label ibObjNo) const;
+
+    mutable std::vector<StencilCache> stencilCaches_;
 };
 
 #endif
@@ -192,6 +192,11 @@ ImmersedBoundary::ImmersedBoundary(const Input &input,
                 input.boundaryInput().get<Scalar>("ImmersedBoundaryCollisions.stiffness", 1e-4),
                 input.boundaryInput().get<Scalar>("ImmersedBoundaryCollisions.range", 0.)
                 );
+
+    collisionBroadPhase_ = std::make_shared<CollisionBroadPhase>(
+                input.boundaryInput().get<Scalar>("ImmersedBoundaryCollisions.range", 0.),
+                input.boundaryInput().get<Scalar>("ImmersedBoundaryCollisions.skinWidth", 0.)
+                );
 }
 
 void ImmersedBoundary::setDomainCells(const std::shared_ptr<CellGroup> &domainCells)
@@ -326,13 +331,12 @@ void ImmersedBoundary::applyHydrodynamicForce(Scalar rho,
                                               const Vector2D &g)
 {   
     if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->applyForce(collisionModel_->force(*ibObjP, *ibObjQ));
+    {
+        auto fc = collisionForces(true);
 
-            ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
-        }
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+            ibObjs_[i]->applyForce(fc[i]);
+    }
 }
 
 void ImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho,
@@ -342,41 +346,33 @@ void ImmersedBoundary::applyHydrodynamicForce(const ScalarFiniteVolumeField &rho
                                               const Vector2D &g)
 {   
     if (collisionModel_)
-        for (auto ibObjP: ibObjs_)
-        {
-            for (auto ibObjQ: ibObjs_)
-                ibObjP->applyForce(collisionModel_->force(*ibObjP, *ibObjQ));
+    {
+        auto fc = collisionForces(true);
 
-            ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
-        }
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+            ibObjs_[i]->applyForce(fc[i]);
+    }
 }
 
 void ImmersedBoundary::applyCollisionForce(bool add)
 {
     if(collisionModel_)
-        for (auto ibObjP: ibObjs_)
+    {
+        //- Collisions with particles only, domain boundaries are not included
+        auto fc = collisionForces(false);
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
         {
             //- Dont compute if no motion
-            if(!ibObjP->motion())
+            if(!ibObjs_[i]->motion())
                 continue;
 
-            Vector2D fc(0., 0.);
-
-            //- Collisions with particles
-            for (auto ibObjQ: ibObjs_)
-                fc += collisionModel_->force(*ibObjP, *ibObjQ);
-
             if(add)
-                ibObjP->addForce(fc);
+                ibObjs_[i]->addForce(fc[i]);
             else
-                ibObjP->applyForce(fc);
-
-            //- Collisions with domain boundaries
-            //            if(add)
-            //                ibObjP->addForce(collisionModel_->force(*ibObjP, *grid_));
-            //            else
-            //                ibObjP->applyForce(collisionModel_->force(*ibObjP, *grid_));
+                ibObjs_[i]->applyForce(fc[i]);
         }
+    }
 }
 
 
@@ -394,3 +390,30 @@ void ImmersedBoundary::setCellStatus()
 
     grid_->sendMessages(*cellStatus_);
 }
+
+std::vector<Vector2D> ImmersedBoundary::collisionForces(bool includeWalls)
+{
+    std::vector<Vector2D> fc(ibObjs_.size(), Vector2D(0., 0.));
+
+    //- Only pairs with overlapping bounding boxes reach the narrow phase
+    collisionBroadPhase_->updateCandidatePairs(ibObjs_);
+
+    for (const auto &pair: collisionBroadPhase_->candidatePairs())
+    {
+        const ImmersedBoundaryObject &ibObjP = *ibObjs_[pair.first];
+        const ImmersedBoundaryObject &ibObjQ = *ibObjs_[pair.second];
+
+        fc[pair.first] += collisionModel_->force(ibObjP, ibObjQ);
+        fc[pair.second] += collisionModel_->force(ibObjQ, ibObjP);
+    }
+
+    if (includeWalls)
+    {
+        collisionBroadPhase_->updateWallFaces(ibObjs_, *grid_);
+
+        for (Label i = 0; i < ibObjs_.size(); ++i)
+            fc[i] += collisionModel_->force(*ibObjs_[i], collisionBroadPhase_->wallFaces(i));
+    }
+
+    return fc;
+}
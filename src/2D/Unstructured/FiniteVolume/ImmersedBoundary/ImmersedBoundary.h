@@ -6,6 +6,7 @@
 #include "FiniteVolume/Equation/FiniteVolumeEquation.h"
 #include "ImmersedBoundaryObject.h"
 #include "CollisionModel.h"
+#include "CollisionBroadPhase.h"
 
 class ImmersedBoundary
 {
@@ -106,6 +107,8 @@ protected:
 
     void setCellStatus();
 
+    std::vector<Vector2D> collisionForces(bool includeWalls);
+
     std::shared_ptr<CellGroup> domainCells_;
 
     std::shared_ptr<FiniteVolumeField<int>> cellStatus_;
@@ -116,6 +119,8 @@ protected:
 
     //- Collision model
     std::shared_ptr<CollisionModel> collisionModel_;
+
+    std::shared_ptr<CollisionBroadPhase> collisionBroadPhase_;
 };
 
 #endif
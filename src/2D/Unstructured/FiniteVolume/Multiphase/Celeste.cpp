@@ -9,6 +9,12 @@ Celeste::Celeste(const Input &input,
     computeStencils();
 }
 
+void Celeste::updateGrid()
+{
+    SurfaceTensionForce::updateGrid();
+    computeStencils();
+}
+
 void Celeste::computeFaceInterfaceForces(const ScalarFiniteVolumeField &gamma, const ScalarGradient &gradGamma)
 {
     computeGradGammaTilde(gamma);
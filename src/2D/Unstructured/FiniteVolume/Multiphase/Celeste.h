@@ -18,6 +18,8 @@ public:
 
     virtual void computeInterfaceForces(const ScalarFiniteVolumeField &gamma, const ScalarGradient &gradGamma);
 
+    void updateGrid() override;
+
 protected:
 
     class Stencil
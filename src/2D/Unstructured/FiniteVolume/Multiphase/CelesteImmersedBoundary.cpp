@@ -137,36 +137,18 @@ void CelesteImmersedBoundary::applyFluidForces(const ScalarFiniteVolumeField &rh
         Index row = 0;
         for(const Cell &cell: ibObj->ibCells())
         {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(cell, ib);
+            const auto &st = ib.stencil(cell);
 
             //- Compute the stress tensor
-            Matrix A(st.nReconstructionPoints(), 6), rhs(st.nReconstructionPoints(), 2);
-
-            int i = 0;
-            for(const Cell *cell: st.cells())
-            {
-                Point2D x = cell->centroid();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {u(*cell).x, u(*cell).y});
-            }
-
-            for(const auto &compatPt: st.compatPts())
-            {
-                Point2D x = compatPt.pt();
-                A.setRow(i, {x.x * x.x, x.y * x.y, x.x * x.y, x.x, x.y, 1.});
-                rhs.setRow(i++, {compatPt.velocity().x, compatPt.velocity().y});
-            }
-
             Point2D xb = ibObj->nearestIntersect(cell.centroid());
-            auto coeffs = solve(A, rhs);
-            auto derivs = Matrix(2, 6, {
-                                     2. * xb.x, 0., xb.y, 1., 0., 0.,
-                                     0., 2. * xb.y, xb.x, 0., 1., 0.
-                                 }) * coeffs;
+            auto coeffs = st.velocityFitCoeffs(u);
 
             //- The tensor is tranposed here
 
-            auto tau = Tensor2D(derivs(0, 0), derivs(1, 0), derivs(0, 1), derivs(1, 1));
+            auto tau = Tensor2D(2. * xb.x * coeffs(0, 0) + xb.y * coeffs(2, 0) + coeffs(3, 0),
+                                2. * xb.y * coeffs(1, 0) + xb.x * coeffs(2, 0) + coeffs(4, 0),
+                                2. * xb.x * coeffs(0, 1) + xb.y * coeffs(2, 1) + coeffs(3, 1),
+                                2. * xb.y * coeffs(1, 1) + xb.x * coeffs(2, 1) + coeffs(4, 1));
 
 
             auto clst = ContactLineStencil(*ibObj,
@@ -39,6 +39,14 @@ void SurfaceTensionForce::setCellGroup(const std::shared_ptr<const CellGroup> &f
     gradGammaTilde_->setCellGroup(fluid);
 }
 
+void SurfaceTensionForce::updateGrid()
+{
+    kernels_.clear();
+
+    for(const Cell &cell: *fluid_)
+        kernels_.push_back(SmoothingKernel(cell, kernelWidth_, kernelType_));
+}
+
 void SurfaceTensionForce::computeInterfaceNormals()
 {
     const VectorFiniteVolumeField &gradGammaTilde = *gradGammaTilde_;
@@ -51,6 +51,9 @@ public:
 
     virtual void setCellGroup(const std::shared_ptr<const CellGroup> &fluid);
 
+    //- Rebuilds the data that refers to grid entities after the grid has been adapted
+    virtual void updateGrid();
+
     //- Internal field pointers
     const std::shared_ptr<VectorFiniteVolumeField> &fst() const
     { return fst_; }
@@ -0,0 +1,273 @@
+#include "AdaptiveQuadtreeGrid.h"
+
+AdaptiveQuadtreeGrid::AdaptiveQuadtreeGrid(const Input &input)
+    :
+      AdaptiveQuadtreeGrid(input.caseInput().get<Scalar>("Grid.width") * input.caseInput().get<Scalar>("Grid.convertToMeters", 1.),
+                           input.caseInput().get<Scalar>("Grid.height") * input.caseInput().get<Scalar>("Grid.convertToMeters", 1.),
+                           input.caseInput().get<int>("Grid.nCellsX"),
+                           input.caseInput().get<int>("Grid.nCellsY"),
+                           input.caseInput().get<int>("Grid.maxLevel", 2),
+                           input.caseInput().get<std::string>("Grid.origin", "(0,0)"))
+{
+
+}
+
+AdaptiveQuadtreeGrid::AdaptiveQuadtreeGrid(Scalar width, Scalar height,
+                                           Size nCellsX, Size nCellsY,
+                                           int maxLevel,
+                                           const Point2D &origin)
+    :
+      FiniteVolumeGrid2D(),
+      nCellsX_(nCellsX),
+      nCellsY_(nCellsY),
+      maxLevel_(maxLevel),
+      hx_(width / nCellsX),
+      hy_(height / nCellsY),
+      origin_(origin)
+{
+    if (comm().nProcs() > 1)
+        throw Exception("AdaptiveQuadtreeGrid", "AdaptiveQuadtreeGrid", "adaptive grids do not support parallel runs.");
+
+    if (maxLevel_ < 0 || (std::max(nCellsX_, nCellsY_) << maxLevel_) >= (1 << 28))
+        throw Exception("AdaptiveQuadtreeGrid", "AdaptiveQuadtreeGrid", "invalid maximum refinement level.");
+
+    build();
+}
+
+bool AdaptiveQuadtreeGrid::adapt(const std::vector<int> &targetLevels, Projection &projection)
+{
+    projection.clear();
+
+    if (targetLevels.size() != cells_.size())
+        throw Exception("AdaptiveQuadtreeGrid", "adapt", "a target level is needed for every cell.");
+
+    //- Highest level any leaf below a node asks for, the leaves themselves included
+    std::unordered_map<std::uint64_t, int> need;
+    std::unordered_map<std::uint64_t, Label> oldLeafIds;
+
+    for (Label id = 0; id < leaves_.size(); ++id)
+    {
+        std::uint64_t key = leaves_[id];
+        int level = nodeLevel(key);
+        int target = std::max(0, std::min(targetLevels[id], maxLevel_));
+        int desired = target > level ? target : (target < level ? level - 1 : level);
+
+        oldLeafIds[key] = id;
+
+        for (std::uint64_t k = key;; k = parentKey(k))
+        {
+            auto insert = need.insert(std::make_pair(k, desired));
+            insert.first->second = std::max(insert.first->second, desired);
+
+            if (nodeLevel(k) == 0)
+                break;
+        }
+    }
+
+    //- Build the new tree top down. Nodes below an old leaf take the level asked for by that leaf
+    std::unordered_set<std::uint64_t> oldSplits;
+    oldSplits.swap(splits_);
+
+    std::vector<std::pair<std::uint64_t, int>> stack;
+
+    for (Label j = 0; j < nCellsY_; ++j)
+        for (Label i = 0; i < nCellsX_; ++i)
+        {
+            stack.push_back(std::make_pair(nodeKey(0, i, j), 0));
+
+            while (!stack.empty())
+            {
+                std::uint64_t key = stack.back().first;
+                auto it = need.find(key);
+                int n = it != need.end() ? it->second : stack.back().second;
+                stack.pop_back();
+
+                if (n <= nodeLevel(key))
+                    continue;
+
+                split(key);
+
+                for (int cj = 0; cj < 2; ++cj)
+                    for (int ci = 0; ci < 2; ++ci)
+                        stack.push_back(std::make_pair(childKey(key, ci, cj), n));
+            }
+        }
+
+    if (splits_ == oldSplits)
+        return false;
+
+    Size nOldCells = leaves_.size();
+
+    build();
+
+    //- Refined cells take the value of the old cell containing them, coarsened cells the volume average of the old
+    //- cells they contain, which conserves the volume integrals of the fields
+    projection.resize(leaves_.size());
+
+    for (Label id = 0; id < leaves_.size(); ++id)
+    {
+        std::uint64_t key = leaves_[id];
+        auto it = oldLeafIds.find(key);
+
+        if (it != oldLeafIds.end())
+            projection[id].push_back(std::make_pair(it->second, 1.));
+        else if (oldSplits.find(key) != oldSplits.end())
+        {
+            std::vector<std::uint64_t> children(1, key);
+
+            while (!children.empty())
+            {
+                std::uint64_t k = children.back();
+                children.pop_back();
+
+                for (int cj = 0; cj < 2; ++cj)
+                    for (int ci = 0; ci < 2; ++ci)
+                    {
+                        std::uint64_t child = childKey(k, ci, cj);
+                        auto leaf = oldLeafIds.find(child);
+
+                        if (leaf != oldLeafIds.end())
+                            projection[id].push_back(
+                                        std::make_pair(leaf->second, std::ldexp(1., -2 * (nodeLevel(child) - nodeLevel(key)))));
+                        else
+                            children.push_back(child);
+                    }
+            }
+        }
+        else
+        {
+            std::uint64_t k = key;
+
+            do
+                k = parentKey(k);
+            while (oldLeafIds.find(k) == oldLeafIds.end());
+
+            projection[id].push_back(std::make_pair(oldLeafIds[k], 1.));
+        }
+    }
+
+    comm().printf("Adapted quadtree grid from %d to %d cells.\n", (int) nOldCells, (int) leaves_.size());
+
+    return true;
+}
+
+//- Private methods
+
+void AdaptiveQuadtreeGrid::split(std::uint64_t key)
+{
+    int level = nodeLevel(key);
+
+    if (level >= maxLevel_ || !splits_.insert(key).second)
+        return;
+
+    if (level == 0)
+        return;
+
+    //- The node must exist, and its children may not be more than one level finer than the leaves across its edges
+    split(parentKey(key));
+
+    long i = nodeI(key), j = nodeJ(key);
+
+    for (const auto &offset: {std::make_pair(-1, 0), std::make_pair(1, 0), std::make_pair(0, -1), std::make_pair(0, 1)})
+    {
+        long ni = i + offset.first, nj = j + offset.second;
+
+        if (inDomain(level, ni, nj))
+            split(nodeKey(level - 1, ni >> 1, nj >> 1));
+    }
+}
+
+void AdaptiveQuadtreeGrid::build()
+{
+    //- Nodes are placed on the lattice of the finest level
+    const std::uint64_t s0 = std::uint64_t(1) << maxLevel_;
+
+    std::unordered_map<std::uint64_t, Label> nodeIds;
+    std::vector<Point2D> nodes;
+    std::vector<Label> cptr(1, 0), cind;
+    std::unordered_map<std::string, std::vector<Label>> patches;
+
+    auto node = [&](std::uint64_t I, std::uint64_t J) -> Label
+    {
+        auto insert = nodeIds.insert(std::make_pair((I << 32) | J, (Label) nodes.size()));
+
+        if (insert.second)
+            nodes.push_back(Point2D(I * hx_ / s0, J * hy_ / s0));
+
+        return insert.first->second;
+    };
+
+    leaves_.clear();
+
+    //- Leaves are numbered depth first within each base cell, so the cells of a subtree stay close in memory
+    std::vector<std::uint64_t> stack;
+
+    for (Label j = 0; j < nCellsY_; ++j)
+        for (Label i = 0; i < nCellsX_; ++i)
+        {
+            stack.push_back(nodeKey(0, i, j));
+
+            while (!stack.empty())
+            {
+                std::uint64_t key = stack.back();
+                stack.pop_back();
+
+                if (splits_.find(key) != splits_.end())
+                {
+                    stack.insert(stack.end(), {childKey(key, 1, 1), childKey(key, 0, 1),
+                                               childKey(key, 1, 0), childKey(key, 0, 0)});
+                    continue;
+                }
+
+                leaves_.push_back(key);
+
+                int level = nodeLevel(key);
+                long li = nodeI(key), lj = nodeJ(key);
+                std::uint64_t s = s0 >> level, h = s / 2, I = li * s, J = lj * s;
+
+                //- A split neighbour of the same level puts a hanging node on the shared edge
+                auto finer = [this, level](long ni, long nj)
+                {
+                    return inDomain(level, ni, nj) && splits_.find(nodeKey(level, ni, nj)) != splits_.end();
+                };
+
+                cind.push_back(node(I, J));
+
+                if (finer(li, lj - 1))
+                    cind.push_back(node(I + h, J));
+
+                cind.push_back(node(I + s, J));
+
+                if (finer(li + 1, lj))
+                    cind.push_back(node(I + s, J + h));
+
+                cind.push_back(node(I + s, J + s));
+
+                if (finer(li, lj + 1))
+                    cind.push_back(node(I + h, J + s));
+
+                cind.push_back(node(I, J + s));
+
+                if (finer(li - 1, lj))
+                    cind.push_back(node(I, J + h));
+
+                cptr.push_back(cind.size());
+
+                //- Default patches, same as the rectilinear grid
+                if (li == 0)
+                    patches["x-"].insert(patches["x-"].end(), {node(I, J), node(I, J + s)});
+
+                if (li + 1 == long(nCellsX_) << level)
+                    patches["x+"].insert(patches["x+"].end(), {node(I + s, J), node(I + s, J + s)});
+
+                if (lj == 0)
+                    patches["y-"].insert(patches["y-"].end(), {node(I, J), node(I + s, J)});
+
+                if (lj + 1 == long(nCellsY_) << level)
+                    patches["y+"].insert(patches["y+"].end(), {node(I, J + s), node(I + s, J + s)});
+            }
+        }
+
+    FiniteVolumeGrid2D::init(nodes, cptr, cind, origin_);
+    initPatches(patches);
+}
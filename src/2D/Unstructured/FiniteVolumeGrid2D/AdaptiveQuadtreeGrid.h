@@ -0,0 +1,80 @@
+#ifndef PHASE_ADAPTIVE_QUADTREE_GRID_H
+#define PHASE_ADAPTIVE_QUADTREE_GRID_H
+
+#include <unordered_set>
+
+#include "System/Input.h"
+
+#include "FiniteVolumeGrid2D.h"
+
+//- A rectilinear base grid whose cells are the roots of quadtrees that can be refined and coarsened during the run.
+//- Neighbouring leaves differ by at most one level across a face, the coarser cell of a level jump gets a hanging node
+//- at the mid-point of the shared edge and is treated as a general polygon. Serial only
+class AdaptiveQuadtreeGrid : public FiniteVolumeGrid2D
+{
+public:
+
+    //- For each cell of the adapted grid, the cells of the previous grid it overlaps and their volume weights
+    typedef std::vector<std::vector<std::pair<Label, Scalar>>> Projection;
+
+    AdaptiveQuadtreeGrid(const Input &input);
+
+    AdaptiveQuadtreeGrid(Scalar width, Scalar height, Size nCellsX, Size nCellsY, int maxLevel,
+                         const Point2D &origin = Point2D(0., 0.));
+
+    //- Moves every leaf towards its target level, refining all the way in one adaptation and coarsening by at most
+    //- one level where all four siblings agree, then restores the level balance. Returns false if the grid did not
+    //- change, in which case the projection is left empty
+    bool adapt(const std::vector<int> &targetLevels, Projection &projection);
+
+    int maxLevel() const
+    { return maxLevel_; }
+
+    int level(const Cell &cell) const
+    { return nodeLevel(leaves_[cell.id()]); }
+
+private:
+
+    //- Quadtree nodes are keyed by their level and their integer position among the nodes of that level
+    static std::uint64_t nodeKey(int level, std::uint64_t i, std::uint64_t j)
+    { return (std::uint64_t(level) << 56) | (i << 28) | j; }
+
+    static int nodeLevel(std::uint64_t key)
+    { return key >> 56; }
+
+    static std::uint64_t nodeI(std::uint64_t key)
+    { return (key >> 28) & 0xFFFFFFF; }
+
+    static std::uint64_t nodeJ(std::uint64_t key)
+    { return key & 0xFFFFFFF; }
+
+    static std::uint64_t parentKey(std::uint64_t key)
+    { return nodeKey(nodeLevel(key) - 1, nodeI(key) >> 1, nodeJ(key) >> 1); }
+
+    static std::uint64_t childKey(std::uint64_t key, int ci, int cj)
+    { return nodeKey(nodeLevel(key) + 1, 2 * nodeI(key) + ci, 2 * nodeJ(key) + cj); }
+
+    bool inDomain(int level, long i, long j) const
+    { return i >= 0 && j >= 0 && i < (long(nCellsX_) << level) && j < (long(nCellsY_) << level); }
+
+    //- Splits a node and any coarser nodes needed to keep the level balance
+    void split(std::uint64_t key);
+
+    //- Rebuilds the grid from the leaves of the current tree
+    void build();
+
+    Size nCellsX_, nCellsY_;
+
+    int maxLevel_;
+
+    Scalar hx_, hy_;
+
+    Point2D origin_;
+
+    //- Internal nodes of the tree and the leaf of each cell
+    std::unordered_set<std::uint64_t> splits_;
+
+    std::vector<std::uint64_t> leaves_;
+};
+
+#endif
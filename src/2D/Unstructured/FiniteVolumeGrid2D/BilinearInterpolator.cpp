@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "BilinearInterpolator.h"
 
 BilinearInterpolator::BilinearInterpolator(const std::weak_ptr<const FiniteVolumeGrid2D> &grid, const Point2D &pt)
@@ -9,29 +11,61 @@ BilinearInterpolator::BilinearInterpolator(const std::weak_ptr<const FiniteVolum
 
 void BilinearInterpolator::setPoint(const Point2D &pt)
 {
+    //- The previous stencil node is gone once the grid has been rebuilt
+    Size revision = grid_.lock()->revision();
+
+    if (revision != revision_)
+    {
+        node_ = nullptr;
+        revision_ = revision;
+    }
+
+    const Node &node = nearestNode(pt);
     pt_ = pt;
-    cells_ = grid_.lock()->findNearestNode(pt_).cells();
-    isValid_ = cells_.size() == 4;
+
+    if (&node != node_)
+    {
+        node_ = &node;
+        cells_ = node.cells();
+        isValid_ = cells_.size() == 4;
+
+        if (isValid_)
+        {
+            Point2D x1 = cells_[0].get().centroid();
+            Point2D x2 = cells_[1].get().centroid();
+            Point2D x3 = cells_[2].get().centroid();
+            Point2D x4 = cells_[3].get().centroid();
+
+            A_ = inverse<4>({
+                                    x1.x * x1.y, x1.x, x1.y, 1.,
+                                    x2.x * x2.y, x2.x, x2.y, 1.,
+                                    x3.x * x3.y, x3.x, x3.y, 1.,
+                                    x4.x * x4.y, x4.x, x4.y, 1.,
+                            });
+        }
+    }
 
     if (isValid_)
+        coeffs_ = StaticMatrix<1, 4>({pt_.x * pt_.y, pt_.x, pt_.y, 1.}) * A_;
+}
+
+std::vector<Scalar> BilinearInterpolator::operator()(const ScalarFiniteVolumeField &field, const std::vector<Point2D> &pts)
+{
+    std::vector<Scalar> vals;
+    vals.reserve(pts.size());
+
+    for (const Point2D &pt: pts)
     {
-        Point2D x1 = cells_[0].get().centroid();
-        Point2D x2 = cells_[1].get().centroid();
-        Point2D x3 = cells_[2].get().centroid();
-        Point2D x4 = cells_[3].get().centroid();
-
-        A_ = inverse<4>({
-                                x1.x * x1.y, x1.x, x1.y, 1.,
-                                x2.x * x2.y, x2.x, x2.y, 1.,
-                                x3.x * x3.y, x3.x, x3.y, 1.,
-                                x4.x * x4.y, x4.x, x4.y, 1.,
-                        });
+        setPoint(pt);
+        vals.push_back(isValid_ ? (*this)(field) : std::numeric_limits<Scalar>::quiet_NaN());
     }
+
+    return vals;
 }
 
 StaticMatrix<1, 4> BilinearInterpolator::coeffs() const
 {
-    return StaticMatrix<1, 4>({pt_.x * pt_.y, pt_.x, pt_.y, 1.}) * A_;
+    return coeffs_;
 }
 
 StaticMatrix<2, 4> BilinearInterpolator::derivativeCoeffs() const
@@ -46,7 +80,6 @@ StaticMatrix<1, 4> BilinearInterpolator::derivativeCoeffs(const Vector2D &n) con
 
 Scalar BilinearInterpolator::operator()(const ScalarFiniteVolumeField &field) const
 {
-    auto x = StaticMatrix<1, 4>({pt_.x * pt_.y, pt_.x, pt_.y, 1.});
     auto b = StaticMatrix<4, 1>({
                                         field(cells_[0]),
                                         field(cells_[1]),
@@ -54,13 +87,11 @@ Scalar BilinearInterpolator::operator()(const ScalarFiniteVolumeField &field) co
                                         field(cells_[3])
                                 });
 
-    return (x * A_ * b)(0, 0);
+    return (coeffs_ * b)(0, 0);
 }
 
 Vector2D BilinearInterpolator::operator()(const VectorFiniteVolumeField &field) const
 {
-    auto x = StaticMatrix<1, 4>({pt_.x * pt_.y, pt_.x, pt_.y, 1.});
-
     auto b = StaticMatrix<4, 2>({
                                         field(cells_[0]).x, field(cells_[0]).y,
                                         field(cells_[1]).x, field(cells_[1]).y,
@@ -68,7 +99,7 @@ Vector2D BilinearInterpolator::operator()(const VectorFiniteVolumeField &field)
                                         field(cells_[3]).x, field(cells_[3]).y
                                 });
 
-    auto u = x * A_ * b;
+    auto u = coeffs_ * b;
     return Vector2D(u(0, 0), u(0, 1));
 }
 
@@ -101,3 +132,53 @@ Tensor2D BilinearInterpolator::grad(const VectorFiniteVolumeField &field) const
 
     return Tensor2D(x(0, 0), x(0, 1), x(1, 0), x(1, 1));
 }
+
+const Node &BilinearInterpolator::nearestNode(const Point2D &pt) const
+{
+    if (!node_)
+        return grid_.lock()->findNearestNode(pt);
+
+    //- Greedy walk over the node graph, starting from the last stencil node
+    const Node *node = node_;
+    Scalar minDistSqr = (pt - *node).magSqr();
+
+    for (int step = 0; step < maxWalkSteps_; ++step)
+    {
+        const Node *next = node;
+
+        for (const Cell &cell: node->cells())
+            for (const Node &nb: cell.nodes())
+            {
+                Scalar distSqr = (pt - nb).magSqr();
+
+                if (distSqr < minDistSqr)
+                {
+                    minDistSqr = distSqr;
+                    next = &nb;
+                }
+            }
+
+        if (next == node)
+        {
+            //- A local minimum is only accepted if the point is covered by the cells around it, and no node of the
+            //- cells around the covering cell is closer
+            for (const Cell &cell: node->cells())
+                if (cell.shape().isInside(pt))
+                {
+                    for (const Node &cellNode: cell.nodes())
+                        for (const Cell &nbCell: cellNode.cells())
+                            for (const Node &nb: nbCell.nodes())
+                                if ((pt - nb).magSqr() < minDistSqr)
+                                    return grid_.lock()->findNearestNode(pt);
+
+                    return *node;
+                }
+
+            break;
+        }
+
+        node = next;
+    }
+
+    return grid_.lock()->findNearestNode(pt);
+}
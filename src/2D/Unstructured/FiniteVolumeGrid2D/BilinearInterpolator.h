@@ -17,8 +17,14 @@ public:
 
     BilinearInterpolator(const std::weak_ptr<const FiniteVolumeGrid2D> &grid, const Point2D &pt);
 
+    //- Moves the stencil to pt. The nearest node is found by walking from the previous stencil node, and the
+    //- coefficient matrix is only rebuilt when the stencil cells change
     void setPoint(const Point2D &pt);
 
+    //- Evaluates the field at several points, reusing the stencil between consecutive points. Points without a valid
+    //- stencil evaluate to NaN
+    std::vector<Scalar> operator()(const ScalarFiniteVolumeField &field, const std::vector<Point2D> &pts);
+
     StaticMatrix<1, 4> coeffs() const;
 
     StaticMatrix<2, 4> derivativeCoeffs() const;
@@ -44,12 +50,22 @@ public:
 
 private:
 
+    const Node &nearestNode(const Point2D &pt) const;
+
+    static const int maxWalkSteps_ = 32;
+
     bool isValid_ = false;
 
     Point2D pt_;
 
+    const Node *node_ = nullptr;
+
+    Size revision_ = 0;
+
     StaticMatrix<4, 4> A_;
 
+    StaticMatrix<1, 4> coeffs_;
+
     std::vector<Ref<const Cell>> cells_;
 
     std::weak_ptr<const FiniteVolumeGrid2D> grid_;
@@ -4,6 +4,36 @@
 
 #include "FiniteVolumeGrid2D.h"
 
+//- Stable LSD radix sort on the 64 bit keys, 16 bits per pass. Passes in which all keys share a digit are skipped
+static void radixSort(std::vector<std::pair<std::uint64_t, Label>> &items)
+{
+    std::vector<std::pair<std::uint64_t, Label>> tmp(items.size());
+    std::vector<Size> count(1 << 16);
+
+    for (int shift = 0; shift < 64; shift += 16)
+    {
+        std::fill(count.begin(), count.end(), 0);
+
+        for (const auto &item: items)
+            ++count[(item.first >> shift) & 0xFFFF];
+
+        if (std::find(count.begin(), count.end(), items.size()) != count.end())
+            continue;
+
+        for (Size i = 0, sum = 0; i < count.size(); ++i)
+        {
+            Size n = count[i];
+            count[i] = sum;
+            sum += n;
+        }
+
+        for (const auto &item: items)
+            tmp[count[(item.first >> shift) & 0xFFFF]++] = item;
+
+        items.swap(tmp);
+    }
+}
+
 FiniteVolumeGrid2D::FiniteVolumeGrid2D()
     :
       interiorFaces_("InteriorFaces"),
@@ -31,13 +61,66 @@ void FiniteVolumeGrid2D::init(const std::vector<Point2D> &nodes,
                               const Point2D &origin)
 {
     reset();
+    ++revision_;
 
+    nodes_.reserve(nodes.size());
     for (const Point2D &node: nodes)
         nodes_.push_back(Node(node + origin, *this));
 
-    cells_.reserve(cptr.size() - 1); // very important, can break without reserve
-    for (int i = 0; i < cptr.size() - 1; ++i)
-        createCell(std::vector<Label>(cind.begin() + cptr[i], cind.begin() + cptr[i + 1]));
+    const long nCells = cptr.size() - 1;
+
+    cells_.reserve(nCells); // very important, can break without reserve
+    for (long i = 0; i < nCells; ++i)
+    {
+        cells_.push_back(Cell(std::vector<Label>(cind.begin() + cptr[i], cind.begin() + cptr[i + 1]), *this));
+
+        for (Label j = cptr[i]; j < cptr[i + 1]; ++j)
+            nodes_[cind[j]].addCell(cells_.back());
+    }
+
+    //- Extract all cell edges, the edge starting at cind[j] is stored at position j
+    std::vector<std::pair<std::uint64_t, Label>> edges(cind.size());
+
+#pragma omp parallel for
+    for (long i = 0; i < nCells; ++i)
+        for (Label j = cptr[i], end = cptr[i + 1]; j < end; ++j)
+            edges[j] = std::make_pair(edgeKey(cind[j], cind[j + 1 < end ? j + 1 : cptr[i]]), j);
+
+    //- Sorting pairs up shared edges. The sort is stable, so the first edge of each run is the one encountered first
+    radixSort(edges);
+
+    std::vector<Label> owner(edges.size());
+    Size nFaces = 0;
+
+    for (Label k = 0, l; k < edges.size(); k = l, ++nFaces)
+        for (l = k; l < edges.size() && edges[l].first == edges[k].first; ++l)
+            owner[edges[l].second] = edges[k].second;
+
+    //- Create the faces in the same order as incremental construction would
+    std::vector<Label> edgeFace(edges.size());
+    faces_.reserve(nFaces);
+
+    for (long i = 0; i < nCells; ++i)
+        for (Label j = cptr[i], end = cptr[i + 1]; j < end; ++j)
+        {
+            if (owner[j] == j)
+            {
+                faces_.push_back(Face(cind[j], cind[j + 1 < end ? j + 1 : cptr[i]], *this, Face::BOUNDARY));
+                edgeFace[j] = faces_.back().id();
+            }
+            else
+            {
+                edgeFace[j] = edgeFace[owner[j]];
+                faces_[edgeFace[j]].setType(Face::INTERIOR);
+            }
+
+            faces_[edgeFace[j]].addCell(cells_[i]);
+        }
+
+    faceDirectory_.reserve(nFaces);
+    for (Label k = 0; k < edges.size(); ++k)
+        if (owner[edges[k].second] == edges[k].second)
+            faceDirectory_.push_back(std::make_pair(edges[k].first, edgeFace[edges[k].second]));
 
     init();
 }
@@ -66,9 +149,13 @@ void FiniteVolumeGrid2D::reset()
     //- Interior and boundary face data structures
     interiorFaces_.clear();
     boundaryFaces_.clear();
+    interiorFaceColours_.clear();
+    maxCellNeighbours_ = 0;
+    geometry_.clear();
 
     //- User defined face groups and patches
     patches_.clear();
+    patchRegistry_.clear();
     bBox_ = BoundingBox(Point2D(0., 0.), Point2D(0., 0.));
 }
 
@@ -87,41 +174,6 @@ std::string FiniteVolumeGrid2D::info() const
 }
 
 //- Create grid entities
-Label FiniteVolumeGrid2D::createCell(const std::vector<Label> &nodeIds)
-{
-    using namespace std;
-
-    cells_.push_back(Cell(nodeIds, *this));
-    Cell &newCell = cells_.back();
-
-    for (Label id: nodeIds)
-        nodes_[id].addCell(newCell);
-
-    for (Label i = 0, end = nodeIds.size(); i < end; ++i)
-    {
-        Label n1 = nodeIds[i], n2 = nodeIds[(i + 1) % end];
-
-        auto key = n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1);
-        auto it = faceDirectory_.find(key);
-
-        if (it == faceDirectory_.end()) // face doesn't exist, so create it
-        {
-            faces_.push_back(Face(n1, n2, *this, Face::BOUNDARY));
-            Face &face = faces_.back();
-            faceDirectory_[key] = face.id();
-            face.addCell(newCell);
-        }
-        else // face already exists, but is now an interior face
-        {
-            Face &face = faces_[it->second];
-            face.setType(Face::INTERIOR);
-            face.addCell(newCell);
-        }
-    }
-
-    return newCell.id();
-}
-
 Label FiniteVolumeGrid2D::addNode(const Point2D &point)
 {
     nodes_.push_back(Node(point, *this));
@@ -153,18 +205,20 @@ CellGroup FiniteVolumeGrid2D::globalCellGroup(const CellGroup &localGroup) const
 
 bool FiniteVolumeGrid2D::faceExists(Label n1, Label n2) const
 {
-    using namespace std;
+    auto key = edgeKey(n1, n2);
+    auto it = std::lower_bound(faceDirectory_.begin(), faceDirectory_.end(), std::make_pair(key, Label(0)));
 
-    return faceDirectory_.find(n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1)) != faceDirectory_.end();
+    return it != faceDirectory_.end() && it->first == key;
 }
 
 Label FiniteVolumeGrid2D::findFace(Label n1, Label n2) const
 {
     using namespace std;
 
-    auto it = faceDirectory_.find(n1 < n2 ? make_pair(n1, n2) : make_pair(n2, n1));
+    auto key = edgeKey(n1, n2);
+    auto it = lower_bound(faceDirectory_.begin(), faceDirectory_.end(), make_pair(key, Label(0)));
 
-    if (it == faceDirectory_.end())
+    if (it == faceDirectory_.end() || it->first != key)
         throw Exception("FiniteVolumeGrid2D", "findFace",
                         "no face found between n1 = " + to_string(n1) + ", n2 = " + to_string(n2) + ".");
 
@@ -417,13 +471,10 @@ void FiniteVolumeGrid2D::partition(const Input &input)
 
 void FiniteVolumeGrid2D::init()
 {
+    //- Groups are filled in bulk, so that their search trees are packed rather than built by repeated insertion
     nodeGroup_ = NodeGroup(nodes_.begin(), nodes_.end(), "NodeGroup");
 
-    nodeGroup_.clear();
-    nodeGroup_.add(nodes_.begin(), nodes_.end());
-
-    boundaryFaces_.clear();
-    interiorFaces_.clear();
+    std::vector<Ref<const Face>> boundaryFaces, interiorFaces;
 
     for (const Face &face: faces_)
         if (face.isBoundary())
@@ -431,7 +482,7 @@ void FiniteVolumeGrid2D::init()
             Cell &cell = cells_[face.lCell().id()];
             cell.addBoundaryLink(face);
 
-            boundaryFaces_.add(face);
+            boundaryFaces.push_back(std::cref(face));
         }
         else
         {
@@ -441,11 +492,51 @@ void FiniteVolumeGrid2D::init()
             lCell.addInteriorLink(face, rCell);
             rCell.addInteriorLink(face, lCell);
 
-            interiorFaces_.add(face);
+            interiorFaces.push_back(std::cref(face));
         }
 
-    //- Initialize diagonal links
-    for (Cell &cell: cells_)
+    boundaryFaces_.clear();
+    boundaryFaces_.add(boundaryFaces.begin(), boundaryFaces.end());
+
+    interiorFaces_.clear();
+    interiorFaces_.add(interiorFaces.begin(), interiorFaces.end());
+
+    //- Greedy colouring, the colours used by the faces of each cell are kept as a bit mask
+    std::vector<std::uint64_t> cellColours(cells_.size(), 0);
+    interiorFaceColours_.clear();
+
+    for (const Face &face: interiorFaces)
+    {
+        std::uint64_t used = cellColours[face.lCell().id()] | cellColours[face.rCell().id()];
+        Size colour = 0;
+
+        while (colour < 64 && (used >> colour) & 1)
+            ++colour;
+
+        if (colour == 64)
+            throw Exception("FiniteVolumeGrid2D", "init", "could not colour the interior faces, cells have too many faces.");
+
+        cellColours[face.lCell().id()] |= std::uint64_t(1) << colour;
+        cellColours[face.rCell().id()] |= std::uint64_t(1) << colour;
+
+        if (colour == interiorFaceColours_.size())
+            interiorFaceColours_.emplace_back();
+
+        interiorFaceColours_[colour].push_back(std::cref(face));
+    }
+
+    maxCellNeighbours_ = 0;
+    for (const Cell &cell: cells_)
+        maxCellNeighbours_ = std::max(maxCellNeighbours_, (Size) cell.neighbours().size());
+
+    geometry_.init(*this);
+
+    //- Initialize diagonal links, each cell only modifies its own links
+#pragma omp parallel for
+    for (long i = 0; i < (long) cells_.size(); ++i)
+    {
+        Cell &cell = cells_[i];
+
         for (const Node &node: cell.nodes())
             for (const Cell &kCell: node.cells())
             {
@@ -454,6 +545,7 @@ void FiniteVolumeGrid2D::init()
                 else if (!cellsShareFace(cell, kCell))
                     cell.addDiagonalLink(kCell);
             }
+    }
 
     //    //- Initialize the patch registry
     //    patchRegistry_.clear();
@@ -491,40 +583,24 @@ void FiniteVolumeGrid2D::initCommBuffers(const std::vector<Label> &ownership, co
                         "initCommBuffers",
                         "ownership and global id vector size must match the number of cells.");
 
-    cellOwnership_ = ownership;
-    globalIds_ = globalIds;
-
-    sendCellGroups_ = std::vector<CellGroup>(comm_->nProcs());
-    bufferCellGroups_ = std::vector<CellGroup>(comm_->nProcs());
-
-    localCells_.clear();
-    localCells_.add(cells_.begin(), cells_.end());
+    //- Buffer cells are received in local id order
+    std::vector<std::vector<Label>> recvOrders(comm_->nProcs());
 
     for (const Cell &cell: cells_)
-        if (cellOwnership_[cell.id()] != comm_->rank())
-        {
-            bufferCellGroups_[cellOwnership_[cell.id()]].add(cell);
-            localCells_.remove(cell);
-        }
-
-    std::vector<std::vector<Label>> recvOrders(comm_->nProcs());
+        if (ownership[cell.id()] != comm_->rank())
+            recvOrders[ownership[cell.id()]].push_back(globalIds[cell.id()]);
 
     for (int proc = 0; proc < comm_->nProcs(); ++proc)
-    {
-        if (proc == comm_->rank())
-            continue;
-
-        for (const Cell &cell: bufferCellGroups_[proc])
-            recvOrders[proc].push_back(globalIds_[cell.id()]);
-
-        comm_->isend(proc, recvOrders[proc], comm_->rank());
-    }
+        if (proc != comm_->rank())
+            comm_->isend(proc, recvOrders[proc], comm_->rank());
 
     std::unordered_map<Label, Label> globalToLocalIdMap;
 
     for (Label id = 0; id < cells_.size(); ++id)
         globalToLocalIdMap[globalIds[id]] = id;
 
+    std::vector<std::vector<Label>> sendCells(comm_->nProcs());
+
     for (int proc = 0; proc < comm_->nProcs(); ++proc)
     {
         if (proc == comm_->rank())
@@ -534,8 +610,56 @@ void FiniteVolumeGrid2D::initCommBuffers(const std::vector<Label> &ownership, co
         comm_->recv(proc, sendOrder, proc);
 
         for (Label id: sendOrder)
-            sendCellGroups_[proc].add(cells_[globalToLocalIdMap[id]]);
+            sendCells[proc].push_back(globalToLocalIdMap[id]);
     }
 
     comm_->waitAll();
+
+    initCommBuffers(ownership, globalIds, sendCells);
+}
+
+void FiniteVolumeGrid2D::initCommBuffers(const std::vector<Label> &ownership,
+                                         const std::vector<Label> &globalIds,
+                                         const std::vector<std::vector<Label>> &sendCells)
+{
+    if (ownership.size() != cells_.size() || globalIds.size() != cells_.size())
+        throw Exception("FiniteVolumeGrid2D",
+                        "initCommBuffers",
+                        "ownership and global id vector size must match the number of cells.");
+
+    if (sendCells.size() != comm_->nProcs())
+        throw Exception("FiniteVolumeGrid2D",
+                        "initCommBuffers",
+                        "there must be one send list per process.");
+
+    cellOwnership_ = ownership;
+    globalIds_ = globalIds;
+
+    sendCellGroups_ = std::vector<CellGroup>(comm_->nProcs());
+    bufferCellGroups_ = std::vector<CellGroup>(comm_->nProcs());
+
+    std::vector<Ref<const Cell>> localCells;
+    std::vector<std::vector<Ref<const Cell>>> bufferCells(comm_->nProcs());
+
+    for (const Cell &cell: cells_)
+        if (cellOwnership_[cell.id()] == comm_->rank())
+            localCells.push_back(std::cref(cell));
+        else
+            bufferCells[cellOwnership_[cell.id()]].push_back(std::cref(cell));
+
+    localCells_.clear();
+    localCells_.add(localCells.begin(), localCells.end());
+
+    for (int proc = 0; proc < comm_->nProcs(); ++proc)
+    {
+        bufferCellGroups_[proc].add(bufferCells[proc].begin(), bufferCells[proc].end());
+
+        std::vector<Ref<const Cell>> send;
+        send.reserve(sendCells[proc].size());
+
+        for (Label id: sendCells[proc])
+            send.push_back(std::cref(cells_[id]));
+
+        sendCellGroups_[proc].add(send.begin(), send.end());
+    }
 }
@@ -1,6 +1,7 @@
 #ifndef PHASE_FINITE_VOLUME_GRID_2D_H
 #define PHASE_FINITE_VOLUME_GRID_2D_H
 
+#include <cstdint>
 #include <unordered_map>
 
 #include "System/Input.h"
@@ -12,6 +13,7 @@
 #include "Cell/CellGroup.h"
 #include "Face/Face.h"
 #include "Face/FaceGroup.h"
+#include "GridGeometry.h"
 
 #include "Geometry/BoundingBox.h"
 
@@ -51,9 +53,11 @@ public:
 
     std::string info() const;
 
-    //- Create grid entities
-    Label createCell(const std::vector<Label> &nodeIds);
+    //- Incremented every time the grid is initialized, so data built on the grid can tell when it is stale
+    Size revision() const
+    { return revision_; }
 
+    //- Create grid entities
     Label addNode(const Point2D &point);
 
     //- Node related methods
@@ -100,6 +104,17 @@ public:
     const FaceGroup &boundaryFaces() const
     { return boundaryFaces_; }
 
+    //- Interior faces grouped so that no two faces of a colour share a cell
+    const std::vector<std::vector<Ref<const Face>>> &interiorFaceColours() const
+    { return interiorFaceColours_; }
+
+    Size maxCellNeighbours() const
+    { return maxCellNeighbours_; }
+
+    //- Geometric coefficients of the faces and cells, precomputed by init
+    const GridGeometry &geometry() const
+    { return geometry_; }
+
     bool faceExists(Label n1, Label n2) const;
 
     Label findFace(Label n1, Label n2) const;
@@ -157,6 +172,14 @@ protected:
 
     void initCommBuffers(const std::vector<Label> &ownership, const std::vector<Label> &globalIds);
 
+    //- Initialize the comm buffers from known send lists (local cell ids per process), without communication
+    void initCommBuffers(const std::vector<Label> &ownership,
+                         const std::vector<Label> &globalIds,
+                         const std::vector<std::vector<Label>> &sendCells);
+
+    static std::uint64_t edgeKey(Label n1, Label n2)
+    { return n1 < n2 ? (std::uint64_t(n1) << 32) | n2 : (std::uint64_t(n2) << 32) | n1; }
+
     //- Node related data
     std::vector<Node> nodes_;
 
@@ -180,16 +203,25 @@ protected:
     //- Face related data
     std::vector<Face> faces_;
 
-    std::map<std::pair<Label, Label>, Label> faceDirectory_; // A directory that can find a face given the two node ids
+    //- A directory that can find a face given the two node ids, sorted by edge key
+    std::vector<std::pair<std::uint64_t, Label>> faceDirectory_;
 
     //- Interior and boundary face data structures
     FaceGroup interiorFaces_, boundaryFaces_;
 
+    std::vector<std::vector<Ref<const Face>>> interiorFaceColours_;
+
+    Size maxCellNeighbours_ = 0;
+
+    GridGeometry geometry_;
+
     std::unordered_map<std::string, FaceGroup> patches_;
 
     std::unordered_map<Label, Ref<const FaceGroup>> patchRegistry_;
 
     BoundingBox bBox_;
+
+    Size revision_ = 0;
 };
 
 #include "FiniteVolumeGrid2D.tpp"
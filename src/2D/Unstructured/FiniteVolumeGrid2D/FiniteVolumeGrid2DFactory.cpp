@@ -1,6 +1,8 @@
 #include "FiniteVolumeGrid2DFactory.h"
 #include "CgnsUnstructuredGrid.h"
 #include "StructuredRectilinearGrid.h"
+#include "PreprocessedGrid.h"
+#include "AdaptiveQuadtreeGrid.h"
 
 std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(GridType type, const Input &input)
 {
@@ -14,6 +16,14 @@ std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(GridType t
         case CGNS:
             grid = std::make_shared<CgnsUnstructuredGrid>(input);
             break;
+        case ADAPTIVE:
+            return std::make_shared<AdaptiveQuadtreeGrid>(input);
+        case PREPROCESSED:
+        {
+            auto preprocessedGrid = std::make_shared<PreprocessedGrid>();
+            preprocessedGrid->load(preprocessedGridFilename(preprocessedGrid->comm().rank()));
+            return preprocessedGrid;
+        }
         case LOAD:
             auto grid = std::make_shared<CgnsUnstructuredGrid>();
             grid->load("./solution/Proc" + std::to_string(grid->comm().rank()) + "/Grid.cgns", Vector2D(0., 0.));
@@ -39,6 +49,10 @@ std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(std::strin
         return create(CGNS, input);
     else if (type == "load")
         return create(LOAD, input);
+    else if (type == "preprocessed")
+        return create(PREPROCESSED, input);
+    else if (type == "adaptive")
+        return create(ADAPTIVE, input);
 
     throw Exception("FiniteVolumeGrid2DFactory", "create", "grid \"" + type + "\" is not a valid grid type.");
 }
@@ -50,8 +64,15 @@ std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(const Inpu
 
 std::shared_ptr<FiniteVolumeGrid2D> FiniteVolumeGrid2DFactory::create(const CommandLine &cl, const Input &input)
 {
-    if (cl.get<bool>("use-partitioned-grid") || cl.get<bool>("restart"))
+    if (cl.get<bool>("use-preprocessed-grid"))
+        return create(PREPROCESSED, input);
+    else if (cl.get<bool>("use-partitioned-grid") || cl.get<bool>("restart"))
         return create(LOAD, input);
     else
         return create(input);
 }
+
+std::string FiniteVolumeGrid2DFactory::preprocessedGridFilename(int rank)
+{
+    return "./solution/Proc" + std::to_string(rank) + "/Grid.bin";
+}
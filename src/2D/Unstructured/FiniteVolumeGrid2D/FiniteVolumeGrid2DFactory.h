@@ -13,7 +13,9 @@ public:
     {
         CGNS,
         RECTILINEAR,
-        LOAD
+        LOAD,
+        PREPROCESSED,
+        ADAPTIVE
     };
 
     static std::shared_ptr<FiniteVolumeGrid2D> create(GridType type, const Input &input);
@@ -23,6 +25,9 @@ public:
     static std::shared_ptr<FiniteVolumeGrid2D> create(const Input &input);
 
     static std::shared_ptr<FiniteVolumeGrid2D> create(const CommandLine &cl, const Input &input);
+
+    //- Location of the preprocessed grid file for a process
+    static std::string preprocessedGridFilename(int rank);
 };
 
 
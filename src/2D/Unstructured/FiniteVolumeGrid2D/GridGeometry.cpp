@@ -0,0 +1,57 @@
+#include "FiniteVolumeGrid2D.h"
+#include "GridGeometry.h"
+
+void GridGeometry::init(const FiniteVolumeGrid2D &grid)
+{
+    const std::vector<Face> &faces = grid.faces();
+    const std::vector<Cell> &cells = grid.cells();
+
+    sf_.resize(faces.size());
+    laplacianVec_.resize(faces.size());
+    tangent_.resize(faces.size());
+    polarSf_.resize(faces.size());
+    laplacianWeight_.resize(faces.size());
+    volumeWeight_.resize(faces.size());
+    distanceWeight_.resize(faces.size());
+    polarLaplacianWeight_.resize(faces.size());
+
+#pragma omp parallel for
+    for (long i = 0; i < (long) faces.size(); ++i)
+    {
+        const Face &face = faces[i];
+        const Cell &lCell = face.lCell();
+
+        Vector2D d = face.isBoundary() ? face.centroid() - lCell.centroid() : face.rCell().centroid() - lCell.centroid();
+        Vector2D sf = face.outwardNorm();
+        Vector2D polarSf = face.polarOutwardNorm(lCell.centroid());
+        Scalar w = dot(d, sf) / d.magSqr();
+
+        sf_[i] = sf;
+        laplacianWeight_[i] = w;
+        laplacianVec_[i] = d / d.magSqr();
+        tangent_[i] = sf.tangentVec().unitVec();
+        polarSf_[i] = polarSf;
+        polarLaplacianWeight_[i] = dot(d, polarSf) / d.magSqr();
+
+        volumeWeight_[i] = face.isBoundary() ? 1. : face.volumeWeight();
+        distanceWeight_[i] = face.isBoundary() ? 1. : face.distanceWeight();
+    }
+
+    polarVolume_.resize(cells.size());
+
+    for (const Cell &cell: cells)
+        polarVolume_[cell.id()] = cell.polarVolume();
+}
+
+void GridGeometry::clear()
+{
+    sf_.clear();
+    laplacianVec_.clear();
+    tangent_.clear();
+    polarSf_.clear();
+    laplacianWeight_.clear();
+    volumeWeight_.clear();
+    distanceWeight_.clear();
+    polarLaplacianWeight_.clear();
+    polarVolume_.clear();
+}
@@ -0,0 +1,77 @@
+#ifndef PHASE_GRID_GEOMETRY_H
+#define PHASE_GRID_GEOMETRY_H
+
+#include <vector>
+
+#include "Cell/Cell.h"
+#include "Face/Face.h"
+
+class FiniteVolumeGrid2D;
+
+//- Purely geometric coefficients of a static grid, computed once and stored in flat arrays indexed by face or cell id.
+//- Face vectors point out of lCell, for boundary faces d is the vector from lCell to the face centroid
+class GridGeometry
+{
+public:
+
+    void init(const FiniteVolumeGrid2D &grid);
+
+    void clear();
+
+    //- Face normal scaled by the face length
+    const Vector2D &sf(const Face &face) const
+    { return sf_[face.id()]; }
+
+    Vector2D sf(const InteriorLink &nb) const
+    { return isLCell(nb) ? sf_[nb.face().id()] : -sf_[nb.face().id()]; }
+
+    //- Orthogonal Laplacian weight, dot(d, sf) / |d|^2
+    Scalar laplacianWeight(const Face &face) const
+    { return laplacianWeight_[face.id()]; }
+
+    //- d / |d|^2, for the face gradient of a difference across the face
+    const Vector2D &laplacianVec(const Face &face) const
+    { return laplacianVec_[face.id()]; }
+
+    Vector2D laplacianVec(const InteriorLink &nb) const
+    { return isLCell(nb) ? laplacianVec_[nb.face().id()] : -laplacianVec_[nb.face().id()]; }
+
+    //- Unit tangent, the sign is arbitrary
+    const Vector2D &tangent(const Face &face) const
+    { return tangent_[face.id()]; }
+
+    //- Interpolation weights of lCell, one on boundary faces
+    Scalar volumeWeight(const Face &face) const
+    { return volumeWeight_[face.id()]; }
+
+    Scalar distanceWeight(const Face &face) const
+    { return distanceWeight_[face.id()]; }
+
+    //- Axisymmetric face normal, scaled by the area per radian swept by the face
+    const Vector2D &polarSf(const Face &face) const
+    { return polarSf_[face.id()]; }
+
+    Vector2D polarSf(const InteriorLink &nb) const
+    { return isLCell(nb) ? polarSf_[nb.face().id()] : -polarSf_[nb.face().id()]; }
+
+    //- dot(d, polarSf) / |d|^2
+    Scalar polarLaplacianWeight(const Face &face) const
+    { return polarLaplacianWeight_[face.id()]; }
+
+    //- Axisymmetric cell volume per radian
+    Scalar polarVolume(const Cell &cell) const
+    { return polarVolume_[cell.id()]; }
+
+private:
+
+    static bool isLCell(const InteriorLink &nb)
+    { return nb.face().lCell().id() == nb.self().id(); }
+
+    std::vector<Vector2D> sf_, laplacianVec_, tangent_, polarSf_;
+
+    std::vector<Scalar> laplacianWeight_, volumeWeight_, distanceWeight_, polarLaplacianWeight_;
+
+    std::vector<Scalar> polarVolume_;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef PHASE_GROUP_H
 #define PHASE_GROUP_H
 
+#include <atomic>
 #include <string>
 #include <unordered_set>
 
@@ -25,14 +26,27 @@ public:
         { return item.centroid(); }
     };
 
-    Group(const std::string &name = "") : Set<T>(name)
+    typedef boost::geometry::index::rtree<Ref<const T>, Parameters, IndexableGetter, typename Set<T>::EqualTo> RTree;
+
+    Group(const std::string &name = "") : Set<T>(name), rTreeIsValid_(true)
     {}
 
     template<class const_iterator>
     Group(const_iterator first, const_iterator last, const std::string &name = "") : Group(name)
     { add(first, last); }
 
+    //- Copies do not carry the search tree, it is rebuilt on the first query
+    Group(const Group<T> &other) : Set<T>(other), rTreeIsValid_(other.empty())
+    {}
+
+    Group(Group<T> &&other) : Set<T>(std::move(other)), rTree_(std::move(other.rTree_)), rTreeIsValid_(other.rTreeIsValid_.load())
+    {}
+
     //- Assignment
+    Group<T> &operator=(const Group<T> &rhs);
+
+    Group<T> &operator=(Group<T> &&rhs);
+
     Group<T> &operator=(const std::vector<Ref<const T>> &rhs);
 
     //- Sizing
@@ -67,7 +81,8 @@ public:
     template<class Container>
     void nearestItems(const Point2D &pt, std::size_t k, Container &c) const
     {
-        std::copy(rTree_.qbegin(boost::geometry::index::nearest(pt, k)), rTree_.qend(), std::back_inserter(c));
+        const RTree &rTree = this->rTree();
+        std::copy(rTree.qbegin(boost::geometry::index::nearest(pt, k)), rTree.qend(), std::back_inserter(c));
     }
 
     const T &nearestItem(const Point2D &pt) const;
@@ -78,7 +93,15 @@ public:
 
 protected:
 
-    boost::geometry::index::rtree<Ref<const T>, Parameters, IndexableGetter, typename Set<T>::EqualTo> rTree_; //- For searching
+    //- The search tree is only built when the group is first queried, and invalidated by any modification
+    const RTree &rTree() const;
+
+    void invalidateRTree()
+    { rTreeIsValid_ = false; }
+
+    mutable RTree rTree_; //- For searching
+
+    mutable std::atomic<bool> rTreeIsValid_;
 };
 
 #include "Group.tpp"
@@ -7,11 +7,34 @@ Group<T> &Group<T>::operator=(const std::vector<Ref<const T> > &rhs)
     return *this;
 }
 
+template<class T>
+Group<T> &Group<T>::operator=(const Group<T> &rhs)
+{
+    if (this != &rhs)
+    {
+        Set<T>::operator=(rhs);
+        rTree_.clear();
+        rTreeIsValid_ = rhs.empty();
+    }
+
+    return *this;
+}
+
+template<class T>
+Group<T> &Group<T>::operator=(Group<T> &&rhs)
+{
+    Set<T>::operator=(std::move(rhs));
+    rTree_ = std::move(rhs.rTree_);
+    rTreeIsValid_ = rhs.rTreeIsValid_.load();
+    return *this;
+}
+
 template<class T>
 void Group<T>::clear()
 {
     Set<T>::clear();
     rTree_.clear();
+    rTreeIsValid_ = true;
 }
 
 template<class T>
@@ -19,7 +42,7 @@ bool Group<T>::add(const T &item)
 {
     if (Set<T>::add(item))
     {
-        rTree_.insert(std::cref(item));
+        invalidateRTree();
         return true;
     }
 
@@ -30,21 +53,20 @@ template<class T>
 void Group<T>::add(typename Set<T>::const_iterator begin, typename Set<T>::const_iterator end)
 {
     Set<T>::add(begin, end);
-    rTree_.insert(begin, end);
+    invalidateRTree();
 }
 
 template<class T>
 void Group<T>::add(typename std::vector<T>::const_iterator begin, typename std::vector<T>::const_iterator end)
 {
     Set<T>::add(begin, end);
-    rTree_.insert(begin, end);
+    invalidateRTree();
 }
 
 template<class T>
 void Group<T>::add(const Set<T> &set)
 {
-    Set<T>::add(set);
-    rTree_.insert(set.begin(), set.end());
+    add(set.begin(), set.end());
 }
 
 template<class T>
@@ -52,7 +74,7 @@ bool Group<T>::remove(const T &item)
 {
     if (Set<T>::remove(item))
     {
-        rTree_.remove(std::cref(item));
+        invalidateRTree();
         return true;
     }
 
@@ -63,14 +85,31 @@ template<class T>
 void Group<T>::remove(typename Set<T>::const_iterator begin, typename Set<T>::const_iterator end)
 {
     Set<T>::remove(begin, end);
-    rTree_.remove(begin, end);
+    invalidateRTree();
 }
 
 template<class T>
 void Group<T>::remove(const Set<T> &set)
 {
     Set<T>::remove(set);
-    rTree_.remove(set.begin(), set.end());
+    invalidateRTree();
+}
+
+template<class T>
+const typename Group<T>::RTree &Group<T>::rTree() const
+{
+    if (!rTreeIsValid_)
+    {
+#pragma omp critical(GroupRTree)
+        if (!rTreeIsValid_)
+        {
+            //- Packing the whole tree at once is faster than repeated insertion and gives better queries
+            rTree_ = RTree(Set<T>::begin(), Set<T>::end());
+            rTreeIsValid_ = true;
+        }
+    }
+
+    return rTree_;
 }
 
 template<class T>
@@ -81,15 +120,15 @@ std::vector<Ref<const T> > Group<T>::itemsWithin(const Shape2D &shape) const
     switch (shape.type())
     {
     case Shape2D::CIRCLE:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::within(shape.boundingBox())
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::within(shape.boundingBox())
                                                        && bgi::satisfies([&shape](const T &item) { return shape.isInside(item.centroid()); })),
-                                         rTree_.qend());
+                                         rTree().qend());
     case Shape2D::BOX:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::within(shape.boundingBox())),
-                                         rTree_.qend());
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::within(shape.boundingBox())),
+                                         rTree().qend());
     case Shape2D::POLYGON:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::within(static_cast<const Polygon &>(shape).boostRing())),
-                                         rTree_.qend());
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::within(static_cast<const Polygon &>(shape).boostRing())),
+                                         rTree().qend());
     }
 }
 
@@ -101,16 +140,16 @@ std::vector<Ref<const T> > Group<T>::itemsCoveredBy(const Shape2D &shape) const
     switch (shape.type())
     {
     case Shape2D::CIRCLE:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::covered_by(shape.boundingBox())
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::covered_by(shape.boundingBox())
                                                        && bgi::satisfies([&shape](const T &item) { return shape.isCovered(item.centroid()); })),
-                                         rTree_.qend());
+                                         rTree().qend());
 
     case Shape2D::BOX:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::covered_by(shape.boundingBox())),
-                                         rTree_.qend());
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::covered_by(shape.boundingBox())),
+                                         rTree().qend());
     case Shape2D::POLYGON:
-        return std::vector<Ref<const T>>(rTree_.qbegin(bgi::covered_by(static_cast<const Polygon &>(shape).boostRing())),
-                                         rTree_.qend());
+        return std::vector<Ref<const T>>(rTree().qbegin(bgi::covered_by(static_cast<const Polygon &>(shape).boostRing())),
+                                         rTree().qend());
     }
 }
 
@@ -123,16 +162,16 @@ void Group<T>::itemsWithin(const Shape2D &shape, std::vector<Ref<const T>> &resu
     {
     case Shape2D::CIRCLE:
         result.assign(
-                    rTree_.qbegin(bgi::within(shape.boundingBox())
+                    rTree().qbegin(bgi::within(shape.boundingBox())
                                   && bgi::satisfies([&shape](const T &item) { return shape.isInside(item.centroid()); })),
-                    rTree_.qend());
+                    rTree().qend());
     case Shape2D::BOX:
         result.assign(
-                    rTree_.qbegin(bgi::within(shape.boundingBox())),
-                    rTree_.qend());
+                    rTree().qbegin(bgi::within(shape.boundingBox())),
+                    rTree().qend());
     case Shape2D::POLYGON:
-        result.assign(rTree_.qbegin(bgi::within(static_cast<const Polygon &>(shape).boostRing())),
-                      rTree_.qend());
+        result.assign(rTree().qbegin(bgi::within(static_cast<const Polygon &>(shape).boostRing())),
+                      rTree().qend());
     }
 }
 
@@ -145,16 +184,16 @@ void Group<T>::itemsCoveredBy(const Shape2D &shape, std::vector<Ref<const T>> &r
     {
     case Shape2D::CIRCLE:
         result.assign(
-                    rTree_.qbegin(bgi::covered_by(shape.boundingBox())
+                    rTree().qbegin(bgi::covered_by(shape.boundingBox())
                                   && bgi::satisfies([&shape](const T &item) { return shape.isCovered(item.centroid()); })),
-                    rTree_.qend());
+                    rTree().qend());
 
     case Shape2D::BOX:
-        result.assign(rTree_.qbegin(bgi::covered_by(shape.boundingBox())),
-                      rTree_.qend());
+        result.assign(rTree().qbegin(bgi::covered_by(shape.boundingBox())),
+                      rTree().qend());
     case Shape2D::POLYGON:
-        result.assign(rTree_.qbegin(bgi::covered_by(static_cast<const Polygon &>(shape).boostRing())),
-                      rTree_.qend());
+        result.assign(rTree().qbegin(bgi::covered_by(static_cast<const Polygon &>(shape).boostRing())),
+                      rTree().qend());
     }
 }
 
@@ -162,13 +201,13 @@ template<class T>
 std::vector<Ref<const T> > Group<T>::nearestItems(const Point2D &pt, size_t k) const
 {
     namespace bgi = boost::geometry::index;
-    return std::vector<Ref<const T>>(rTree_.qbegin(bgi::nearest(pt, k)), rTree_.qend());
+    return std::vector<Ref<const T>>(rTree().qbegin(bgi::nearest(pt, k)), rTree().qend());
 }
 
 template<class T>
 const T &Group<T>::nearestItem(const Point2D &pt) const
 {
-    return *(rTree_.qbegin(boost::geometry::index::nearest(pt, 1)));
+    return *(rTree().qbegin(boost::geometry::index::nearest(pt, 1)));
 }
 
 template<class T>
@@ -0,0 +1,237 @@
+#include <fstream>
+#include <cstring>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "PreprocessedGrid.h"
+
+constexpr std::uint64_t PreprocessedGrid::version;
+
+constexpr char PreprocessedGrid::magic_[8];
+
+//- FNV-1a over 8 byte words
+static void updateChecksum(std::uint64_t &checksum, const std::uint64_t *words, Size nWords)
+{
+    for (Size i = 0; i < nWords; ++i)
+    {
+        checksum ^= words[i];
+        checksum *= 1099511628211ull;
+    }
+}
+
+static void writeWords(std::ostream &out, std::uint64_t &checksum, const std::vector<std::uint64_t> &words)
+{
+    updateChecksum(checksum, words.data(), words.size());
+    out.write(reinterpret_cast<const char *>(words.data()), words.size() * sizeof(std::uint64_t));
+}
+
+PreprocessedGrid::PreprocessedGrid()
+    :
+      FiniteVolumeGrid2D()
+{
+
+}
+
+PreprocessedGrid::PreprocessedGrid(const std::string &filename)
+    :
+      PreprocessedGrid()
+{
+    load(filename);
+}
+
+void PreprocessedGrid::load(const std::string &filename)
+{
+    namespace bip = boost::interprocess;
+
+    bip::file_mapping file(filename.c_str(), bip::read_only);
+    bip::mapped_region region(file, bip::read_only);
+
+    const char *data = static_cast<const char *>(region.get_address());
+
+    Header header;
+
+    if (region.get_size() < sizeof(Header))
+        throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" is too small to be a preprocessed grid.");
+
+    std::memcpy(&header, data, sizeof(Header));
+
+    if (std::memcmp(header.magic, magic_, sizeof(magic_)) != 0)
+        throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" is not a preprocessed grid.");
+
+    if (header.version != version)
+        throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" has version " + std::to_string(header.version)
+                        + ", expected version " + std::to_string(version) + ". Regenerate the preprocessed grid.");
+
+    if (header.nProcs != comm_->nProcs() || header.rank != comm_->rank())
+        throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" was written for rank " + std::to_string(header.rank)
+                        + " of " + std::to_string(header.nProcs) + " processes.");
+
+    if (region.get_size() != sizeof(Header) + header.payloadSize || header.payloadSize % sizeof(std::uint64_t) != 0)
+        throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" is truncated.");
+
+    //- The mapping is page aligned and the header is a multiple of 8 bytes, so the payload can be read as words
+    const std::uint64_t *words = reinterpret_cast<const std::uint64_t *>(data + sizeof(Header));
+    const Size nWords = header.payloadSize / sizeof(std::uint64_t);
+
+    std::uint64_t checksum = 14695981039346656037ull;
+    updateChecksum(checksum, words, nWords);
+
+    if (checksum != header.checksum)
+        throw Exception("PreprocessedGrid", "load", "checksum mismatch in file \"" + filename + "\".");
+
+    Size pos = 0;
+
+    auto next = [&words, &pos, nWords, &filename](Size n) -> const std::uint64_t *
+    {
+        if (pos + n > nWords)
+            throw Exception("PreprocessedGrid", "load", "file \"" + filename + "\" is corrupt.");
+
+        const std::uint64_t *ptr = words + pos;
+        pos += n;
+        return ptr;
+    };
+
+    //- Topology
+    const Scalar *coords = reinterpret_cast<const Scalar *>(next(2 * header.nNodes));
+    std::vector<Point2D> nodes(header.nNodes);
+
+    for (Size i = 0; i < nodes.size(); ++i)
+        nodes[i] = Point2D(coords[2 * i], coords[2 * i + 1]);
+
+    const std::uint64_t *cptr = next(header.nCells + 1);
+    const std::uint64_t *cind = next(header.nCellNodes);
+
+    init(nodes, std::vector<Label>(cptr, cptr + header.nCells + 1), std::vector<Label>(cind, cind + header.nCellNodes),
+         Point2D(0., 0.));
+
+    //- Patches, stored by face id. Face ids are reproduced exactly by init
+    patches_.clear();
+    patchRegistry_.clear();
+
+    for (Size i = 0; i < header.nPatches; ++i)
+    {
+        Size nameSize = *next(1);
+        const char *name = reinterpret_cast<const char *>(next((nameSize + 7) / 8));
+        Size nFaces = *next(1);
+        const std::uint64_t *faces = next(nFaces);
+
+        createPatch(std::string(name, name + nameSize), std::vector<Label>(faces, faces + nFaces));
+    }
+
+    //- Communication groups
+    const std::uint64_t *ownership = next(header.nCells);
+    const std::uint64_t *globalIds = next(header.nCells);
+    std::vector<std::vector<Label>> sendCells(header.nProcs);
+
+    for (auto &send: sendCells)
+    {
+        Size nSend = *next(1);
+        const std::uint64_t *ids = next(nSend);
+        send.assign(ids, ids + nSend);
+    }
+
+    initCommBuffers(std::vector<Label>(ownership, ownership + header.nCells),
+                    std::vector<Label>(globalIds, globalIds + header.nCells),
+                    sendCells);
+
+    comm_->printf("Loaded preprocessed grid \"%s\".\n", filename.c_str());
+}
+
+void PreprocessedGrid::write(const std::string &filename, const FiniteVolumeGrid2D &grid)
+{
+    std::ofstream out(filename, std::ios::binary);
+
+    if (!out)
+        throw Exception("PreprocessedGrid", "write", "could not open file \"" + filename + "\".");
+
+    Header header;
+    std::memcpy(header.magic, magic_, sizeof(magic_));
+    header.version = version;
+    header.nProcs = grid.comm().nProcs();
+    header.rank = grid.comm().rank();
+    header.nNodes = grid.nNodes();
+    header.nCells = grid.nCells();
+    header.nCellNodes = 0;
+    header.nPatches = grid.patches().size();
+
+    for (const Cell &cell: grid.cells())
+        header.nCellNodes += cell.nodes().size();
+
+    //- Placeholder, rewritten once the payload size and checksum are known
+    out.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+    std::uint64_t checksum = 14695981039346656037ull;
+    std::vector<std::uint64_t> words;
+
+    //- Topology
+    words.resize(2 * grid.nNodes());
+
+    for (const Node &node: grid.nodes())
+    {
+        std::memcpy(&words[2 * node.id()], &node.x, sizeof(Scalar));
+        std::memcpy(&words[2 * node.id() + 1], &node.y, sizeof(Scalar));
+    }
+
+    writeWords(out, checksum, words);
+
+    words.assign(1, 0);
+    for (const Cell &cell: grid.cells())
+        words.push_back(words.back() + cell.nodes().size());
+
+    writeWords(out, checksum, words);
+
+    words.clear();
+    for (const Cell &cell: grid.cells())
+        for (const Node &node: cell.nodes())
+            words.push_back(node.id());
+
+    writeWords(out, checksum, words);
+
+    //- Patches
+    for (const FaceGroup &patch: grid.patches())
+    {
+        words.assign(1, patch.name().size());
+        words.resize(1 + (patch.name().size() + 7) / 8, 0);
+        std::memcpy(&words[1], patch.name().data(), patch.name().size());
+
+        words.push_back(patch.size());
+
+        for (const Face &face: patch)
+            words.push_back(face.id());
+
+        writeWords(out, checksum, words);
+    }
+
+    //- Communication groups
+    words.assign(grid.cellOwnership().begin(), grid.cellOwnership().end());
+    writeWords(out, checksum, words);
+
+    words.assign(grid.globalIds().begin(), grid.globalIds().end());
+    writeWords(out, checksum, words);
+
+    for (int proc = 0; proc < grid.comm().nProcs(); ++proc)
+    {
+        //- Serial grids have no send groups
+        words.assign(1, 0);
+
+        if (proc < grid.sendGroups().size())
+        {
+            words[0] = grid.sendGroups()[proc].size();
+
+            for (const Cell &cell: grid.sendGroups()[proc])
+                words.push_back(cell.id());
+        }
+
+        writeWords(out, checksum, words);
+    }
+
+    header.payloadSize = Size(out.tellp()) - sizeof(Header);
+    header.checksum = checksum;
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+
+    if (!out)
+        throw Exception("PreprocessedGrid", "write", "an error occurred writing file \"" + filename + "\".");
+}
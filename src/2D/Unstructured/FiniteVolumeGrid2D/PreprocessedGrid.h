@@ -0,0 +1,39 @@
+#ifndef PHASE_PREPROCESSED_GRID_H
+#define PHASE_PREPROCESSED_GRID_H
+
+#include "FiniteVolumeGrid2D.h"
+
+//- A partitioned grid stored in a flat binary file, one file per process. The file contains the local topology,
+//- node coordinates, patches and communication groups, so loading it needs neither a cgns parse nor a partitioning
+class PreprocessedGrid : public FiniteVolumeGrid2D
+{
+public:
+
+    static constexpr std::uint64_t version = 1;
+
+    PreprocessedGrid();
+
+    PreprocessedGrid(const std::string &filename);
+
+    //- Memory-maps the file, checks the header and checksum and initializes the grid
+    void load(const std::string &filename);
+
+    //- Writes the partition of a grid owned by this process
+    static void write(const std::string &filename, const FiniteVolumeGrid2D &grid);
+
+private:
+
+    //- All fields are 8 bytes wide, the payload is a sequence of 8 byte words
+    struct Header
+    {
+        char magic[8];
+        std::uint64_t version;
+        std::uint64_t nProcs, rank;
+        std::uint64_t nNodes, nCells, nCellNodes, nPatches;
+        std::uint64_t payloadSize, checksum;
+    };
+
+    static constexpr char magic_[8] = {'P', 'H', 'A', 'S', 'E', 'G', 'R', 'D'};
+};
+
+#endif
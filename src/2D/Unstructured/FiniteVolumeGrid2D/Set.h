@@ -55,7 +55,7 @@ public:
     { return items_; }
 
     bool isInSet(const T &item) const
-    { return itemSet_.find(std::cref(item)) != itemSet_.end(); }
+    { return isDense_ ? item.id() < isMember_.size() && isMember_[item.id()] : memberIds_.count(item.id()) > 0; }
 
     //- Add
     virtual bool add(const T &item);
@@ -99,7 +99,19 @@ protected:
 
     std::vector<Ref<const T> > items_; // Used for faster iteration over all cells
 
-    std::unordered_set<Ref<const T>, Hash, EqualTo> itemSet_; // Allows cell lookup via an id
+    //- Set membership. Ids are hashed while the set is sparse in the range of ids it has seen, and moved to an id
+    //- indexed bitset once the bitset would be the smaller of the two, so small sets of large grids stay cheap
+    bool insertId(Label id);
+
+    void eraseId(Label id);
+
+    bool isDense_ = false;
+
+    Label maxId_ = 0;
+
+    std::unordered_set<Label> memberIds_;
+
+    std::vector<bool> isMember_;
 };
 
 #include "Set.tpp"
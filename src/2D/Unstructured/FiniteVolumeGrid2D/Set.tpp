@@ -4,7 +4,10 @@ template<class T>
 void Set<T>::clear()
 {
     items_.clear();
-    itemSet_.clear();
+    isDense_ = false;
+    maxId_ = 0;
+    memberIds_.clear();
+    isMember_.clear();
 }
 
 template<class T>
@@ -34,40 +37,45 @@ template<class T>
 void Set<T>::reserve(Size size)
 {
     items_.reserve(size);
-    itemSet_.reserve(size);
 }
 
 template<class T>
 bool Set<T>::add(const T &item)
 {
-    auto insert = itemSet_.insert(std::cref(item));
+    bool inserted = insertId(item.id());
 
-    if(insert.second)
+    if(inserted)
         items_.push_back(std::cref(item));
 
-    return insert.second;
+    return inserted;
 }
 
 template<class T>
 void Set<T>::add(const_iterator begin, const_iterator end)
 {
     items_.reserve(size() + (end - begin));
-    itemSet_.reserve(size() + (end - begin));
 
     for(auto itr = begin; itr != end; ++itr)
-        if(itemSet_.insert(*itr).second)
-            items_.push_back(*itr);
+    {
+        const T &item = *itr;
+
+        if(insertId(item.id()))
+            items_.push_back(std::cref(item));
+    }
 }
 
 template<class T>
 void Set<T>::add(typename std::vector<T>::const_iterator begin, typename std::vector<T>::const_iterator end)
 {
     items_.reserve(size() + (end - begin));
-    itemSet_.reserve(size() + (end - begin));
 
     for(auto itr = begin; itr != end; ++itr)
-        if(itemSet_.insert(*itr).second)
-            items_.push_back(*itr);
+    {
+        const T &item = *itr;
+
+        if(insertId(item.id()))
+            items_.push_back(std::cref(item));
+    }
 }
 
 template<class T>
@@ -79,10 +87,11 @@ void Set<T>::add(const Set<T> &set)
 template<class T>
 bool Set<T>::remove(const T &item)
 {
-    bool removed = itemSet_.erase(std::cref(item));
+    bool removed = isInSet(item);
 
     if(removed)
     {
+        eraseId(item.id());
         items_.erase(
                     std::find_if(items_.begin(), items_.end(), [&item](const T &arg)
         { return item.id() == arg.id(); })
@@ -95,20 +104,17 @@ bool Set<T>::remove(const T &item)
 template<class T>
 void Set<T>::remove(const_iterator begin, const_iterator end)
 {
-    std::unordered_set<Ref<const T>, Hash, EqualTo> items(begin, end);
-
-    auto itr = std::remove_if(items_.begin(), items_.end(), [&items, this](const T &item) -> bool
+    //- Unmark the items first, then compact the item list in one pass
+    for(auto itr = begin; itr != end; ++itr)
     {
-        if (items.find(std::cref(item)) != items.end())
-        {
-            itemSet_.erase(std::cref(item));
-            return true;
-        }
+        const T &item = *itr;
 
-        return false;
-    });
+        if(isInSet(item))
+            eraseId(item.id());
+    }
 
-    items_.erase(itr, items_.end());
+    items_.erase(std::remove_if(items_.begin(), items_.end(), [this](const T &item)
+    { return !isInSet(item); }), items_.end());
 }
 
 template<class T>
@@ -118,7 +124,7 @@ void Set<T>::remove(const Set<T> &set)
     {
         if (set.isInSet(item))
         {
-            itemSet_.erase(std::cref(item));
+            eraseId(item.id());
             return true;
         }
 
@@ -127,3 +133,47 @@ void Set<T>::remove(const Set<T> &set)
 
     items_.erase(itr, items_.end());
 }
+
+template<class T>
+bool Set<T>::insertId(Label id)
+{
+    if(!isDense_)
+    {
+        if(!memberIds_.insert(id).second)
+            return false;
+
+        maxId_ = std::max(maxId_, id);
+
+        //- A hashed id costs about as much as 256 bits
+        if(256 * memberIds_.size() < maxId_ + 1)
+            return true;
+
+        isMember_.assign(maxId_ + 1, false);
+
+        for(Label memberId: memberIds_)
+            isMember_[memberId] = true;
+
+        memberIds_.clear();
+        isDense_ = true;
+
+        return true;
+    }
+
+    if(id >= isMember_.size())
+        isMember_.resize(std::max(id + 1, 2 * isMember_.size()), false);
+
+    if(isMember_[id])
+        return false;
+
+    isMember_[id] = true;
+    return true;
+}
+
+template<class T>
+void Set<T>::eraseId(Label id)
+{
+    if(isDense_)
+        isMember_[id] = false;
+    else
+        memberIds_.erase(id);
+}
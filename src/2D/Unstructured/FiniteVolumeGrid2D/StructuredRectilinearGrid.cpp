@@ -23,6 +23,15 @@ StructuredRectilinearGrid::StructuredRectilinearGrid(const Input &input)
     init(width, height, nCellsX, nCellsY, convertToMeters, xDimRefinements, yDimRefinements, origin);
 }
 
+StructuredRectilinearGrid::StructuredRectilinearGrid(Scalar width, Scalar height,
+                                                     Size nCellsX, Size nCellsY,
+                                                     const Point2D &origin)
+        :
+        FiniteVolumeGrid2D()
+{
+    init(width, height, nCellsX, nCellsY, 1., {}, {}, origin);
+}
+
 void StructuredRectilinearGrid::init(Scalar width, Scalar height,
                                      Size nCellsX, Size nCellsY,
                                      Scalar convertToMeters,
@@ -11,6 +11,8 @@ public:
 
     StructuredRectilinearGrid(const Input& input);
 
+    StructuredRectilinearGrid(Scalar width, Scalar height, Size nCellsX, Size nCellsY, const Point2D &origin = Point2D(0., 0.));
+
     void init(Scalar width,
               Scalar height,
               Size nCellsX,
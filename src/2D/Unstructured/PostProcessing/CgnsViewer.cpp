@@ -21,49 +21,18 @@ CgnsViewer::CgnsViewer(const Input &input, const Solver &solver)
     casename_ = input.caseInput().get<std::string>("CaseName");
     gridfile_ = (path / "Grid.cgns").string();
 
-    CgnsFile file(gridfile_, CgnsFile::WRITE);
-
-    int bid = file.createBase("Grid", 2, 2);
-
-    int zid = file.createUnstructuredZone(bid, "Zone", solver.grid()->nNodes(), solver.grid()->nCells());
-
-    file.writeCoordinates(bid, zid, solver.grid()->coords());
-
-    auto cptr = solver.grid()->eptr();
-    auto cind = solver.grid()->eind();
-
-    std::transform(cind.begin(), cind.end(), cind.begin(), [](Label id)
-    { return id + 1; });
-
-    file.writeMixedElementSection(bid, zid, "Cells", 1, solver.grid()->nCells(), cptr, cind);
-
-    //- Now write the boundary mesh elements
-    size_t start = solver.grid()->nCells() + 1;
-    for (const FaceGroup &patch: solver.grid()->patches())
-    {
-        size_t end = start + patch.size() - 1;
-
-        std::vector<int> elems;
-
-        for (const Face &face: patch)
-            elems.insert(elems.end(), {(int)face.lNode().id() + 1, (int)face.rNode().id() + 1});
-
-        int sid = file.writeBarElementSection(bid, zid, (patch.name() + "Elements"), start, end, elems);
-        int bcid = file.writeBoCo(bid, zid, patch.name(), start, end);
-
-        start = end + 1;
-    }
-
-    int sid = file.writeSolution(bid, zid, "Info");
-
-    file.writeField(bid, zid, sid, "ProcNo", solver.grid()->cellOwnership());
-    file.writeField(bid, zid, sid, "GlobalID", solver.grid()->globalIds());
-
-    file.close();
+    writeGrid();
 }
 
 void CgnsViewer::write(Scalar time)
 {
+    if (solver_.grid()->revision() != gridRevision_)
+    {
+        gridfile_ = (boost::filesystem::path("solution/Proc" + std::to_string(solver_.grid()->comm().rank()))
+                     / ("Grid" + std::to_string(solver_.grid()->revision()) + ".cgns")).string();
+        writeGrid();
+    }
+
     boost::filesystem::path path = "solution/" + std::to_string(time)
             + "/Proc" + std::to_string(solver_.grid()->comm().rank());
 
@@ -117,3 +86,65 @@ void CgnsViewer::write(Scalar time)
     file.linkNode(bid, zid, sid, "ProcNo", path.c_str(), "/Grid/Zone/Info/ProcNo");
     file.close();
 }
+
+//- Protected methods
+
+void CgnsViewer::writeGrid()
+{
+    CgnsFile file(gridfile_, CgnsFile::WRITE);
+
+    int bid = file.createBase("Grid", 2, 2);
+
+    int zid = file.createUnstructuredZone(bid, "Zone", solver_.grid()->nNodes(), solver_.grid()->nCells());
+
+    file.writeCoordinates(bid, zid, solver_.grid()->coords());
+
+    //- Hanging nodes of adapted grids lie on straight cell edges, they are dropped so that every cell is written as a
+    //- triangle or quadrilateral
+    std::vector<int> cptr(1, 0), cind;
+
+    for (const Cell &cell: solver_.grid()->cells())
+    {
+        const auto &nodes = cell.nodes();
+
+        for (int i = 0, n = nodes.size(); i < n; ++i)
+        {
+            const Node &prev = nodes[(i + n - 1) % n], &node = nodes[i], &next = nodes[(i + 1) % n];
+
+            if (n > 4 && std::abs(cross(node - prev, next - node)) <= 1e-12 * (next - prev).magSqr())
+                continue;
+
+            cind.push_back(node.id() + 1);
+        }
+
+        cptr.push_back(cind.size());
+    }
+
+    file.writeMixedElementSection(bid, zid, "Cells", 1, solver_.grid()->nCells(), cptr, cind);
+
+    //- Now write the boundary mesh elements
+    size_t start = solver_.grid()->nCells() + 1;
+    for (const FaceGroup &patch: solver_.grid()->patches())
+    {
+        size_t end = start + patch.size() - 1;
+
+        std::vector<int> elems;
+
+        for (const Face &face: patch)
+            elems.insert(elems.end(), {(int)face.lNode().id() + 1, (int)face.rNode().id() + 1});
+
+        int sid = file.writeBarElementSection(bid, zid, (patch.name() + "Elements"), start, end, elems);
+        int bcid = file.writeBoCo(bid, zid, patch.name(), start, end);
+
+        start = end + 1;
+    }
+
+    int sid = file.writeSolution(bid, zid, "Info");
+
+    file.writeField(bid, zid, sid, "ProcNo", solver_.grid()->cellOwnership());
+    file.writeField(bid, zid, sid, "GlobalID", solver_.grid()->globalIds());
+
+    file.close();
+
+    gridRevision_ = solver_.grid()->revision();
+}
@@ -17,7 +17,12 @@ public:
 
 protected:
 
+    //- Writes the current grid, a new grid file is started whenever the grid has been adapted
+    void writeGrid();
+
     std::string path_, gridfile_, casename_;
+
+    Size gridRevision_;
 };
 
 #endif
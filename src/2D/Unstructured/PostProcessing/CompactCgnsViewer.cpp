@@ -1,13 +1,15 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include "System/Exception.h"
 #include "Solvers/Solver.h"
 #include "CompactCgnsViewer.h"
 
 CompactCgnsViewer::CompactCgnsViewer(const Input &input, const Solver &solver)
     :
       Viewer(input, solver),
-      solnNo_(0)
+      solnNo_(0),
+      gridRevision_(solver.grid()->revision())
 {
     boost::filesystem::path path = "./solution";
 
@@ -58,6 +60,9 @@ CompactCgnsViewer::CompactCgnsViewer(const Input &input, const Solver &solver)
 
 void CompactCgnsViewer::write(Scalar time)
 {
+    if (solver_.grid()->revision() != gridRevision_)
+        throw Exception("CompactCgnsViewer", "write", "the compact viewer does not support adapted grids, use the cgns viewer.");
+
     CgnsFile file(filename_, CgnsFile::MODIFY);
 
     int sid = file.writeSolution(bid_, zid_, "FlowSolution" + std::to_string(++solnNo_));
@@ -15,7 +15,7 @@ protected:
 
     int bid_, zid_;
 
-    std::size_t solnNo_;
+    std::size_t solnNo_, gridRevision_;
 
     std::string filename_;
 
@@ -1,5 +1,3 @@
-#include "FiniteVolumeGrid2D/BilinearInterpolator.h"
-
 #include "ImmersedBoundaryObjectProbe.h"
 
 ImmersedBoundaryObjectProbe::ImmersedBoundaryObjectProbe(int fileWriteFreq,
@@ -9,7 +7,8 @@ ImmersedBoundaryObjectProbe::ImmersedBoundaryObjectProbe(int fileWriteFreq,
         :
         Object(fileWriteFreq),
         ibObj_(ibObj),
-        field_(field)
+        field_(field),
+        bi_(field.lock()->grid())
 {
 
     path_ /= "ImmersedBoundaryObjectProbes/" + ibObj_.lock()->name() + "/" + field_.lock()->name();
@@ -34,14 +33,12 @@ void ImmersedBoundaryObjectProbe::compute(Scalar time, bool force)
 {
     if (do_update() || force)
     {
-        auto field = field_.lock();
-
-        BilinearInterpolator bi(field->grid(), ibObj_.lock()->position() + probePos_);
+        bi_.setPoint(ibObj_.lock()->position() + probePos_);
 
-        if (bi.isValid())
+        if (bi_.isValid())
         {
             std::ofstream fout(getFilename(), std::ofstream::app);
-            fout << time << "," << bi(*field_.lock()) << "\n";
+            fout << time << "," << bi_(*field_.lock()) << "\n";
             fout.close();
         }
     }
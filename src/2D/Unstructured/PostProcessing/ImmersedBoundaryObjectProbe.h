@@ -3,6 +3,7 @@
 
 #include "PostProcessing.h"
 #include "FiniteVolume/ImmersedBoundary/ImmersedBoundaryObject.h"
+#include "FiniteVolumeGrid2D/BilinearInterpolator.h"
 
 class ImmersedBoundaryObjectProbe : public PostProcessing::Object
 {
@@ -24,6 +25,9 @@ protected:
     std::weak_ptr<const ScalarFiniteVolumeField> field_;
 
     Point2D probePos_;
+
+    //- Kept between writes so the stencil can follow the object incrementally
+    BilinearInterpolator bi_;
 };
 
 #endif
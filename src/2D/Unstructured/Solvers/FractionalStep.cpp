@@ -2,6 +2,7 @@
 #include "FiniteVolume/Discretization/Divergence.h"
 #include "FiniteVolume/Discretization/Laplacian.h"
 #include "FiniteVolume/Discretization/Source.h"
+#include "FiniteVolumeGrid2D/AdaptiveQuadtreeGrid.h"
 
 #include "FractionalStep.h"
 
@@ -18,9 +19,16 @@ FractionalStep::FractionalStep(const Input &input, const std::shared_ptr<const F
       pEqn_(input, p_, "pEqn")
 {
     fluid_->add(grid_->localCells());
+
+    //- Solutions of the old grid are not valid guesses, even if the number of cells is unchanged
+    uEqn_.sparseSolver()->clearSolutions();
+    pEqn_.sparseSolver()->clearSolutions();
     rho_ = input.caseInput().get<Scalar>("Properties.rho", 1);
     mu_ = input.caseInput().get<Scalar>("Properties.mu", 1);
     g_ = input.caseInput().get<std::string>("Properties.g", "(0,0)");
+
+    adaptFrequency_ = input.caseInput().get<int>("Solver.adaptFrequency", 0);
+    nAdaptBufferLayers_ = input.caseInput().get<int>("Solver.adaptBufferLayers", 2);
 }
 
 void FractionalStep::initialize()
@@ -29,6 +37,17 @@ void FractionalStep::initialize()
     p_.setBoundaryFaces();
 }
 
+void FractionalStep::setInitialConditions(const Input &input)
+{
+    Solver::setInitialConditions(input);
+
+    auto grid = std::dynamic_pointer_cast<const AdaptiveQuadtreeGrid>(grid_);
+
+    if (grid)
+        for (int pass = 0; pass < grid->maxLevel() && adaptGrid(true); ++pass)
+            Solver::setInitialConditions(input);
+}
+
 std::string FractionalStep::info() const
 {
     return "Fractional-step\n"
@@ -41,9 +60,8 @@ Scalar FractionalStep::solve(Scalar timeStep)
     solveUEqn(timeStep);
     solvePEqn(timeStep);
     correctVelocity(timeStep);
-
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
+    adaptGrid();
 
     return 0;
 }
@@ -72,14 +90,14 @@ Scalar FractionalStep::maxCourantNumber(Scalar timeStep) const
 
 Scalar FractionalStep::computeMaxTimeStep(Scalar maxCo, Scalar prevTimeStep) const
 {
-    Scalar co = maxCourantNumber(prevTimeStep);
+    //- The Courant number of the last step is already reduced, so the result is the same on every rank
+    Scalar co = diagnostics_.empty() ? maxCourantNumber(prevTimeStep) : diagnostics()[MAX_COURANT_NUMBER];
     Scalar lambda1 = 0.1, lambda2 = 1.2;
 
-    return grid_->comm().min(
-                std::min(
-                    std::min(maxCo / co * prevTimeStep, (1 + lambda1 * maxCo / co) * prevTimeStep),
-                    std::min(lambda2 * prevTimeStep, maxTimeStep_)
-                    ));
+    return std::min(
+                std::min(maxCo / co * prevTimeStep, (1 + lambda1 * maxCo / co) * prevTimeStep),
+                std::min(lambda2 * prevTimeStep, maxTimeStep_)
+                );
 }
 
 Scalar FractionalStep::solveUEqn(Scalar timeStep)
@@ -125,22 +143,132 @@ void FractionalStep::correctVelocity(Scalar timeStep)
         u_(face) -= timeStep * gradP_(face);
 }
 
-Scalar FractionalStep::maxDivergenceError()
+void FractionalStep::computeDiagnostics(Scalar timeStep)
 {
-    Scalar maxError = 0.;
+    const GridGeometry &geom = grid_->geometry();
+    Scalar maxError = 0., maxCo = 0.;
 
     for (const Cell &cell: *fluid_)
     {
-        Scalar div = 0.;
+        Scalar div = 0., co = 0.;
 
         for (const InteriorLink &nb: cell.neighbours())
-            div += dot(u_(nb.face()), nb.outwardNorm());
+        {
+            Scalar flux = dot(u_(nb.face()), geom.sf(nb));
+            div += flux;
+            co += std::max(flux, 0.);
+        }
 
         for (const BoundaryLink &bd: cell.boundaries())
-            div += dot(u_(bd.face()), bd.outwardNorm());
+        {
+            Scalar flux = dot(u_(bd.face()), geom.sf(bd.face()));
+            div += flux;
+            co += std::max(flux, 0.);
+        }
+
+        co *= timeStep / cell.volume();
+        co_(cell) = co;
+
+        maxError = std::max(std::abs(div), maxError);
+        maxCo = std::max(co, maxCo);
+    }
+
+    diagnostics_.assign(N_DIAGNOSTICS, 0.);
+    diagnostics_[MAX_DIVERGENCE_ERROR] = maxError;
+    diagnostics_[MAX_COURANT_NUMBER] = maxCo;
+}
+
+void FractionalStep::reduceDiagnostics(Scalar timeStep)
+{
+    //- A reduction left over from a previous step must complete before its buffer is reused
+    diagnostics();
+
+    computeDiagnostics(timeStep);
+    diagnosticsRequest_ = grid_->comm().imax(diagnostics_);
+}
+
+const std::vector<Scalar> &FractionalStep::diagnostics() const
+{
+    if (diagnosticsRequest_ != MPI_REQUEST_NULL)
+    {
+        grid_->comm().wait(diagnosticsRequest_);
+        grid_->comm().printf("Max divergence error = %.4e\n", diagnostics_[MAX_DIVERGENCE_ERROR]);
+        grid_->comm().printf("Max CFL number = %.4lf\n", diagnostics_[MAX_COURANT_NUMBER]);
+    }
+
+    return diagnostics_;
+}
+
+bool FractionalStep::adaptGrid(bool force)
+{
+    auto grid = std::dynamic_pointer_cast<const AdaptiveQuadtreeGrid>(grid_);
+
+    if (!grid || adaptFrequency_ <= 0 || (!force && ++nStepsSinceAdapt_ < adaptFrequency_))
+        return false;
 
-        maxError = fabs(div) > maxError ? div : maxError;
+    nStepsSinceAdapt_ = 0;
+
+    std::vector<bool> refine(grid_->nCells(), false);
+    markRefinementCells(refine);
+
+    //- Features move less than a cell per step, so the buffer keeps them resolved until the next adaptation
+    for (int layer = 0; layer < nAdaptBufferLayers_; ++layer)
+    {
+        std::vector<bool> grown = refine;
+
+        for (const Cell &cell: grid_->cells())
+            if (refine[cell.id()])
+                for (const CellLink &nb: cell.cellLinks())
+                    grown[nb.cell().id()] = true;
+
+        refine.swap(grown);
     }
 
-    return grid_->comm().max(maxError);
+    std::vector<int> targetLevels(grid_->nCells());
+
+    for (Label id = 0; id < targetLevels.size(); ++id)
+        targetLevels[id] = refine[id] ? grid->maxLevel() : 0;
+
+    //- The grid is owned by the run, the solver is the only one to modify it
+    AdaptiveQuadtreeGrid::Projection projection;
+
+    if (!std::const_pointer_cast<AdaptiveQuadtreeGrid>(grid)->adapt(targetLevels, projection))
+        return false;
+
+    projectFields(projection);
+    updateGridData();
+
+    //- Interpolated face velocities do not satisfy continuity on the new grid, so they are projected again. The
+    //- correction does not depend on the step size, and the pressure of the last step is restored afterwards
+    std::vector<Scalar> p(p_.begin(), p_.end()), pFaces = p_.faces();
+    std::vector<Vector2D> gradP(gradP_.begin(), gradP_.end()), gradPFaces = gradP_.faces();
+
+    pEqn_.sparseSolver()->setRecording(false);
+    solvePEqn(1.);
+    pEqn_.sparseSolver()->setRecording(true);
+    correctVelocity(1.);
+
+    std::copy(p.begin(), p.end(), p_.begin());
+    p_.faces() = pFaces;
+    std::copy(gradP.begin(), gradP.end(), gradP_.begin());
+    gradP_.faces() = gradPFaces;
+
+    return true;
+}
+
+void FractionalStep::markRefinementCells(std::vector<bool> &refine) const
+{
+    if (ib())
+        for (const Cell &cell: ib()->ibCells())
+            refine[cell.id()] = true;
+}
+
+void FractionalStep::updateGridData()
+{
+    fluid_->clear();
+    fluid_->add(grid_->localCells());
+
+    //- The next time step is chosen from the Courant number on the adapted grid
+    diagnostics();
+    diagnostics_.clear();
 }
@@ -15,6 +15,11 @@ public:
 
     virtual void initialize();
 
+    using Solver::setInitialConditions;
+
+    //- On an adaptive grid the initial conditions are set again after each refinement pass, so they are resolved
+    void setInitialConditions(const Input &input) override;
+
     std::string info() const;
 
     virtual Scalar solve(Scalar timeStep);
@@ -31,7 +36,27 @@ protected:
 
     virtual void correctVelocity(Scalar timeStep);
 
-    virtual Scalar maxDivergenceError();
+    //- Step diagnostics, reduced across ranks with a single max reduction
+    enum Diagnostic{MAX_DIVERGENCE_ERROR, MAX_COURANT_NUMBER, N_DIAGNOSTICS};
+
+    //- Local maxima of the diagnostics in one sweep over the fluid cells, also updates co_
+    virtual void computeDiagnostics(Scalar timeStep);
+
+    //- Computes the diagnostics and starts their reduction, which overlaps with any work until they are needed
+    void reduceDiagnostics(Scalar timeStep);
+
+    //- Completes a pending reduction and reports the diagnostics of the last step
+    const std::vector<Scalar> &diagnostics() const;
+
+    //- Adaptive refinement, active on an adaptive quadtree grid when Solver.adaptFrequency is set. The marked cells
+    //- and a buffer of nAdaptBufferLayers_ cells around them are refined to the maximum level, the rest is coarsened
+    bool adaptGrid(bool force = false);
+
+    //- Marks the cells that must be resolved at the maximum level, the IB cells by default
+    virtual void markRefinementCells(std::vector<bool> &refine) const;
+
+    //- Rebuilds the solver data that depends on the grid after the fields have been projected
+    virtual void updateGridData();
 
     Scalar rho_, mu_;
 
@@ -51,6 +76,12 @@ protected:
 
     FiniteVolumeEquation<Scalar> pEqn_;
 
+    mutable std::vector<Scalar> diagnostics_;
+
+    mutable MPI_Request diagnosticsRequest_ = MPI_REQUEST_NULL;
+
+    int adaptFrequency_, nAdaptBufferLayers_, nStepsSinceAdapt_ = 0;
+
 };
 
 #endif
@@ -79,21 +79,39 @@ void FractionalStepAxisymmetric::correctVelocity(Scalar timeStep)
     u_.sendMessages();
 }
 
-Scalar FractionalStepAxisymmetric::maxDivergenceError()
+void FractionalStepAxisymmetric::computeDiagnostics(Scalar timeStep)
 {
-    Scalar maxError = 0.;
+    const GridGeometry &geom = grid_->geometry();
+    Scalar maxError = 0., maxCo = 0.;
 
     for (const Cell &cell: *fluid_)
     {
-        Scalar divU = 0.;
+        Scalar divU = 0., co = 0.;
+
         for (const InteriorLink &nb: cell.neighbours())
-            divU += dot(u_(nb.face()), nb.face().polarOutwardNorm(cell.centroid()));
+        {
+            Scalar flux = dot(u_(nb.face()), geom.polarSf(nb));
+            divU += flux;
+            co += std::max(flux, 0.);
+        }
 
         for (const BoundaryLink &bd: cell.boundaries())
-            divU += dot(u_(bd.face()), bd.face().polarOutwardNorm(cell.centroid()));
+        {
+            Scalar flux = dot(u_(bd.face()), geom.polarSf(bd.face()));
+            divU += flux;
+            co += std::max(flux, 0.);
+        }
+
+        co *= timeStep / geom.polarVolume(cell);
+        co_(cell) = co;
 
-        maxError = std::abs(divU) > maxError ? std::abs(divU) : maxError;
+        maxError = std::max(std::abs(divU), maxError);
+        maxCo = std::max(co, maxCo);
     }
 
-    return grid_->comm().max(maxError);
+    co_.sendMessages();
+
+    diagnostics_.assign(N_DIAGNOSTICS, 0.);
+    diagnostics_[MAX_DIVERGENCE_ERROR] = maxError;
+    diagnostics_[MAX_COURANT_NUMBER] = maxCo;
 }
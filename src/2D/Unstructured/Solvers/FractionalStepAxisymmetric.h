@@ -19,7 +19,7 @@ protected:
 
     virtual void correctVelocity(Scalar timeStep) override;
 
-    Scalar maxDivergenceError() override;
+    virtual void computeDiagnostics(Scalar timeStep) override;
 };
 
 
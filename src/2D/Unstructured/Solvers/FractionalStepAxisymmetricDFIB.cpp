@@ -13,8 +13,7 @@ FractionalStepAxisymmetricDFIB::FractionalStepAxisymmetricDFIB(const Input &inpu
                                                                const std::shared_ptr<const FiniteVolumeGrid2D> &grid)
     :
       FractionalStepAxisymmetric(input, grid),
-      fib_(*addField<Vector2D>("fb", fluid_)),
-      fibEqn_(input, fib_, "fbEqn")
+      fib_(*addField<Vector2D>("fb", fluid_))
 {
     ib_ = std::make_shared<DirectForcingImmersedBoundary>(input, grid, fluid_);
     addField<int>(ib_->cellStatus());
@@ -26,6 +25,9 @@ FractionalStepAxisymmetricDFIB::FractionalStepAxisymmetricDFIB(const Input &inpu
         if(motion)
             motion->setMotionConstraint(Vector2D(0., 1.));
     }
+
+    //- Grid adaptation is not supported by the axisymmetric immersed boundary solvers
+    adaptFrequency_ = 0;
 }
 
 Scalar FractionalStepAxisymmetricDFIB::solve(Scalar timeStep)
@@ -39,8 +41,7 @@ Scalar FractionalStepAxisymmetricDFIB::solve(Scalar timeStep)
     correctVelocity(timeStep);
     computeIbForces(timeStep);
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
 
     return 0.;
 }
@@ -59,9 +60,7 @@ Scalar FractionalStepAxisymmetricDFIB::solveUEqn(Scalar timeStep)
     Scalar error = uEqn_.solve();
     u_.sendMessages();
 
-    fibEqn_ = ib_->computeForcingTerm(u_, timeStep, fib_);
-    fibEqn_.solve();
-    fib_.sendMessages();
+    ib_->solveForcingTerm(u_, timeStep, fib_);
 
     for(const Cell &c: *fluid_)
     {
@@ -77,6 +76,10 @@ Scalar FractionalStepAxisymmetricDFIB::solveUEqn(Scalar timeStep)
 
 void FractionalStepAxisymmetricDFIB::computeIbForces(Scalar timeStep)
 {
+    //- Partial sums of all objects are reduced together
+    std::vector<Vector2D> fhs;
+    fhs.reserve(ib_->ibObjs().size());
+
     for(auto &ibObj: *ib_)
     {
         if(ibObj->shape().type() != Shape2D::CIRCLE || ibObj->shape().centroid().x != 0.)
@@ -107,7 +110,15 @@ void FractionalStepAxisymmetricDFIB::computeIbForces(Scalar timeStep)
             fh -= fib_(c) * c.polarVolume();
         }
 
-        fh = grid_->comm().sum(2. * M_PI * rho_ * fh);
+        fhs.push_back(2. * M_PI * rho_ * fh);
+    }
+
+    fhs = grid_->comm().sum(fhs);
+
+    for(int i = 0; i < fhs.size(); ++i)
+    {
+        const auto &ibObj = ib_->ibObjs()[i];
+        const Vector2D &fh = fhs[i];
 
         //- Assume spherical
         const Circle &circ = static_cast<const Circle&>(ibObj->shape());
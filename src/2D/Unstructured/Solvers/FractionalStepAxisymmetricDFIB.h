@@ -24,10 +24,6 @@ protected:
     std::shared_ptr<DirectForcingImmersedBoundary> ib_;
 
     VectorFiniteVolumeField &fib_;
-
-    FiniteVolumeEquation<Vector2D> fibEqn_;
-
-
 };
 
 #endif
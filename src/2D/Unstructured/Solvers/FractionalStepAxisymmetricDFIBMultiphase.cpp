@@ -64,8 +64,7 @@ Scalar FractionalStepAxisymmetricDFIBMultiphase::solve(Scalar timeStep)
     grid_->comm().printf("Computing IB forces...\n");
     computeIbForces(timeStep);
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
 
     return 0.;
 }
@@ -151,9 +150,7 @@ Scalar FractionalStepAxisymmetricDFIBMultiphase::solveUEqn(Scalar timeStep)
     Scalar error = uEqn_.solve();
     u_.sendMessages();
 
-    fibEqn_ = ib_->computeForcingTerm(u_, timeStep, fib_);
-    fibEqn_.solve();
-    fib_.sendMessages();
+    ib_->solveForcingTerm(u_, timeStep, fib_);
 
     for(const Cell &c: *fluid_)
         u_(c) += timeStep * (fib_(c) + gradP_(c) / rho_(c));
@@ -221,8 +218,16 @@ void FractionalStepAxisymmetricDFIBMultiphase::correctVelocity(Scalar timeStep)
 
 void FractionalStepAxisymmetricDFIBMultiphase::computeIbForces(Scalar timeStep)
 {
-    for(auto &ibObj: *ib_)
+    //- Partial sums and contact lines of all objects are reduced together
+    std::vector<Vector2D> fhs;
+    fhs.reserve(ib_->ibObjs().size());
+
+    contactLines_.clear();
+
+    for(Index objId = 0; objId < ib_->ibObjs().size(); ++objId)
     {
+        const auto &ibObj = ib_->ibObjs()[objId];
+
         if(ibObj->shape().type() != Shape2D::CIRCLE || ibObj->shape().centroid().x != 0.)
             throw Exception("FractionalStepAxisymmetricDFIBMultiphase", "computeIbForces", "oncly circles centered at r = 0 supported.");
 
@@ -250,11 +255,7 @@ void FractionalStepAxisymmetricDFIBMultiphase::computeIbForces(Scalar timeStep)
             fh -= rho_(c) * fib_(c) * c.polarVolume();
         }
 
-        fh = grid_->comm().sum(2. * M_PI * fh);
-
-        Vector2D fc(0., 0.), fb(0., 0.), fw(0., 0.);
-
-        contactLines_.clear();
+        fhs.push_back(2. * M_PI * fh);
 
         auto computeStress = [&ibObj](const Cell &c)
         {
@@ -276,10 +277,23 @@ void FractionalStepAxisymmetricDFIBMultiphase::computeIbForces(Scalar timeStep)
 
             auto st = CelesteAxisymmetricImmersedBoundary::ContactLineStencil(*ibObj, c.centroid(), fst_.theta(*ibObj), gamma_);
             Scalar beta = (st.cl()[1] - ibObj->shape().centroid()).angle();
-            contactLines_.emplace_back(ContactLine{st.cl()[1], beta, st.gamma(), st.ncl(), st.tcl()});
+            contactLines_.emplace_back(ContactLine{st.cl()[1], beta, st.gamma(), st.ncl(), st.tcl(), objId});
         }
+    }
+
+    fhs = grid_->comm().sum(fhs);
+    auto allContactLines = grid_->comm().allGatherv(contactLines_);
+
+    for(Index objId = 0; objId < ib_->ibObjs().size(); ++objId)
+    {
+        const auto &ibObj = ib_->ibObjs()[objId];
+        const Vector2D &fh = fhs[objId];
 
-        contactLines_ = grid_->comm().allGatherv(contactLines_);
+        Vector2D fc(0., 0.), fb(0., 0.), fw(0., 0.);
+
+        contactLines_.clear();
+        std::copy_if(allContactLines.begin(), allContactLines.end(), std::back_inserter(contactLines_),
+                     [objId](const ContactLine &cl) { return cl.ibObjId == objId; });
 
         std::sort(contactLines_.begin(), contactLines_.end(), [&ibObj](const ContactLine &lhs, const ContactLine &rhs)
         { return lhs.beta < rhs.beta; });
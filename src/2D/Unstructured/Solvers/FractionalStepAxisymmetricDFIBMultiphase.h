@@ -26,6 +26,8 @@ protected:
         Scalar gamma;
 
         Vector2D ncl, tcl;
+
+        Index ibObjId;
     };
 
     virtual Scalar solveGammaEqn(Scalar timeStep);
@@ -23,12 +23,18 @@ Scalar FractionalStepBoussinesq::solve(Scalar timeStep)
     correctVelocity(timeStep);
     solveTEqn(timeStep);
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
+    adaptGrid();
 
     return 0;
 }
 
+void FractionalStepBoussinesq::updateGridData()
+{
+    FractionalStep::updateGridData();
+    TEqn_.sparseSolver()->clearSolutions();
+}
+
 Scalar FractionalStepBoussinesq::solveUEqn(Scalar timeStep)
 {
     u_.savePreviousTimeStep(timeStep, 1);
@@ -21,6 +21,8 @@ protected:
 
     Scalar solveTEqn(Scalar timeStep);
 
+    void updateGridData() override;
+
     Scalar alpha_, T0_, kappa_;
 
 };
@@ -1,4 +1,3 @@
-#include "Math/TrilinosAmesosSparseMatrixSolver.h"
 #include "FiniteVolume/ImmersedBoundary/DirectForcingImmersedBoundary.h"
 #include "FiniteVolume/Discretization/TimeDerivative.h"
 #include "FiniteVolume/Discretization/Divergence.h"
@@ -14,7 +13,6 @@ FractionalStepDFIB::FractionalStepDFIB(const Input &input, const std::shared_ptr
     :
       FractionalStep(input, grid),
       fb_(*addField<Vector2D>("fb", fluid_)),
-      fbEqn_(input, fb_, "fbEqn"),
       //extEqn_(input, gradP_, "extEqn"),
       ib_(std::make_shared<DirectForcingImmersedBoundary>(input, grid, fluid_))
 {
@@ -38,8 +36,8 @@ Scalar FractionalStepDFIB::solve(Scalar timeStep)
     grid_->comm().printf("Performing field extensions...\n");
     solveExtEqns();
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
+    adaptGrid();
 
     return 0;
 }
@@ -49,6 +47,12 @@ std::shared_ptr<const ImmersedBoundary> FractionalStepDFIB::ib() const
     return ib_;
 }
 
+void FractionalStepDFIB::updateGridData()
+{
+    FractionalStep::updateGridData();
+    ib_->updateCells();
+}
+
 Scalar FractionalStepDFIB::solveUEqn(Scalar timeStep)
 {
     gradP_.fill(Vector2D(0., 0.), ib_->localIbCells());
@@ -62,9 +66,7 @@ Scalar FractionalStepDFIB::solveUEqn(Scalar timeStep)
     Scalar error = uEqn_.solve();
     u_.sendMessages();
 
-    fbEqn_ = ib_->computeForcingTerm(u_, timeStep, fb_);
-    fbEqn_.solve();
-    fb_.sendMessages();
+    ib_->solveForcingTerm(u_, timeStep, fb_);
 
     for(const Cell &c: u_.cells())
         u_(c) += timeStep * (fb_(c) + gradP_(c));
@@ -77,9 +79,12 @@ Scalar FractionalStepDFIB::solveUEqn(Scalar timeStep)
 
 void FractionalStepDFIB::computIbForce(Scalar timeStep)
 {
+    //- Compute the hydro force from the ib force, the partial sums of all objects are reduced together
+    std::vector<Vector2D> fhs;
+    fhs.reserve(ib_->ibObjs().size());
+
     for(auto &ibObj: *ib_)
     {
-        //- Compute the hydro force from the ib force
         Vector2D fh(0., 0.);
         for(const Cell &c: ibObj->cells())
         {
@@ -104,7 +109,15 @@ void FractionalStepDFIB::computIbForce(Scalar timeStep)
             fh -= fb_(c) * c.volume();
         }
 
-        fh = grid_->comm().sum(rho_ * fh);
+        fhs.push_back(rho_ * fh);
+    }
+
+    fhs = grid_->comm().sum(fhs);
+
+    for(int i = 0; i < fhs.size(); ++i)
+    {
+        const auto &ibObj = ib_->ibObjs()[i];
+        const Vector2D &fh = fhs[i];
 
         Vector2D fw = ibObj->rho * ibObj->shape().area() * g_;
         Vector2D fb = -rho_ * ibObj->shape().area() * g_;
@@ -122,33 +135,5 @@ void FractionalStepDFIB::computIbForce(Scalar timeStep)
 
 void FractionalStepDFIB::solveExtEqns()
 {
-    FiniteVolumeEquation<Vector2D> eqn(gradP_);
-    eqn.setSparseSolver(std::make_shared<TrilinosAmesosSparseMatrixSolver>(grid_->comm()));
-
-    for(const Cell &c: grid_->localCells())
-    {
-        if(ib_->localIbCells().isInSet(c))
-        {
-            auto st = DirectForcingImmersedBoundary::LeastSquaresQuadraticStencil(c, *ib_);
-            auto beta = st.interpolationCoeffs(c.centroid());
-
-            eqn.add(c, c, -1.);
-
-            int i = 0;
-            for(const Cell* ptr: st.cells())
-                eqn.add(c, *ptr, beta(0, i++));
-
-            for(const auto &cmpt: st.compatPts())
-                eqn.addSource(c, -beta(0, i++) * cmpt.acceleration());
-        }
-
-        else
-        {
-            eqn.add(c, c, -1.);
-            eqn.addSource(c, gradP_(c));
-        }
-    }
-
-    eqn.solve();
-    grid_->sendMessages(gradP_);
+    ib_->extendPressureGradient(gradP_);
 }
@@ -22,9 +22,9 @@ protected:
 
     void computIbForce(Scalar timeStep);
 
-    VectorFiniteVolumeField &fb_;
+    void updateGridData() override;
 
-    FiniteVolumeEquation<Vector2D> fbEqn_;
+    VectorFiniteVolumeField &fb_;
 
     std::shared_ptr<DirectForcingImmersedBoundary> ib_;
 };
@@ -31,18 +31,7 @@ FractionalStepDirectForcingMultiphase::FractionalStepDirectForcingMultiphase(con
     mu1_ = input.caseInput().get<Scalar>("Properties.mu1", FractionalStep::mu_);
     mu2_ = input.caseInput().get<Scalar>("Properties.mu2", FractionalStep::mu_);
 
-    capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
-    for (const Face &face: grid_->interiorFaces())
-    {
-        Scalar delta = (face.rCell().centroid() - face.lCell().centroid()).mag();
-        capillaryTimeStep_ = std::min(
-                    capillaryTimeStep_,
-                    std::sqrt(
-                        (rho1_ + rho2_) * std::pow(delta, 3) / (4. * M_PI * fst_->sigma())
-                        ));
-    }
-
-    capillaryTimeStep_ = grid_->comm().min(capillaryTimeStep_);
+    computeCapillaryTimeStep();
 
     addField(fst_->fst());
     addField(fst_->kappa());
@@ -88,8 +77,8 @@ Scalar FractionalStepDirectForcingMultiphase::solve(Scalar timeStep)
     //    grid_->comm().printf("Performing field extensions...\n");
     //    computeFieldExtenstions(timeStep);
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
+    adaptGrid();
 
     return 0;
 }
@@ -140,9 +129,7 @@ Scalar FractionalStepDirectForcingMultiphase::solveUEqn(Scalar timeStep)
     Scalar error = uEqn_.solve();
     u_.sendMessages();
 
-    fbEqn_ = ib_->computeForcingTerm(u_, timeStep, fb_);
-    fbEqn_.solve();
-    fb_.sendMessages();
+    ib_->solveForcingTerm(u_, timeStep, fb_);
 
     for(const Cell& c: *fluid_)
         u_(c) += timeStep * (fb_(c) + gradP_(c) / rho_(c));
@@ -269,9 +256,15 @@ void FractionalStepDirectForcingMultiphase::correctVelocity(Scalar timeStep)
 
 void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
 {
-    for(auto &ibObj: *ib_)
+    //- Partial sums and contact lines of all objects are reduced together
+    std::vector<Vector2D> fhs;
+    fhs.reserve(ib_->ibObjs().size());
+
+    contactLines_.clear();
+
+    for(Index objId = 0; objId < ib_->ibObjs().size(); ++objId)
     {
-        contactLines_.clear();
+        const auto &ibObj = ib_->ibObjs()[objId];
 
         auto computeContactLine = [&ibObj](const Cell &c)
         {
@@ -302,10 +295,48 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             Vector2D ncl = st1.ncl();
             Vector2D tcl = st1.tcl();
 
-            contactLines_.push_back(ContactLine{pt, beta, rho, rgh, gamma, ncl, tcl});
+            contactLines_.push_back(ContactLine{pt, beta, rho, rgh, gamma, ncl, tcl, objId});
+        }
+
+        //- Compute the hydro force from the ib force
+        Vector2D fh(0., 0.);
+        for(const Cell &c: ibObj->cells())
+        {
+            fh += rho_(c) * (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
+
+            for(const InteriorLink &nb: c.neighbours())
+            {
+                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(nb.face()), nb.outwardNorm()) / 2.;
+                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(nb.face()), nb.outwardNorm()) / 2.;
+                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
+                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(nb.cell());
+            }
+
+            for(const BoundaryLink &bd: c.boundaries())
+            {
+                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(bd.face()), bd.outwardNorm()) / 2.;
+                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(bd.face()), bd.outwardNorm()) / 2.;
+                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
+                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(bd.face());
+            }
+
+            fh -= rho_(c) * fb_(c) * c.volume();
         }
 
-        contactLines_ = grid_->comm().allGatherv(contactLines_);
+        fhs.push_back(fh);
+    }
+
+    fhs = grid_->comm().sum(fhs);
+    auto allContactLines = grid_->comm().allGatherv(contactLines_);
+
+    for(Index objId = 0; objId < ib_->ibObjs().size(); ++objId)
+    {
+        const auto &ibObj = ib_->ibObjs()[objId];
+        const Vector2D &fh = fhs[objId];
+
+        contactLines_.clear();
+        std::copy_if(allContactLines.begin(), allContactLines.end(), std::back_inserter(contactLines_),
+                     [objId](const ContactLine &cl) { return cl.ibObjId == objId; });
 
         std::sort(contactLines_.begin(), contactLines_.end(), [](const ContactLine &lhs, const ContactLine &rhs)
         { return lhs.beta < rhs.beta; });
@@ -348,33 +379,6 @@ void FractionalStepDirectForcingMultiphase::computeIbForces(Scalar timeStep)
             }
         }
 
-        //- Compute the hydro force from the ib force
-        Vector2D fh(0., 0.);
-        for(const Cell &c: ibObj->cells())
-        {
-            fh += rho_(c) * (u_(c) - u_.oldField(0)(c)) * c.volume() / timeStep;
-
-            for(const InteriorLink &nb: c.neighbours())
-            {
-                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(nb.face()), nb.outwardNorm()) / 2.;
-                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(nb.face()), nb.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(nb.cell())
-                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(nb.cell());
-            }
-
-            for(const BoundaryLink &bd: c.boundaries())
-            {
-                Scalar flux0 = rho_(c) * dot(u_.oldField(0)(bd.face()), bd.outwardNorm()) / 2.;
-                Scalar flux1 = rho_(c) * dot(u_.oldField(1)(bd.face()), bd.outwardNorm()) / 2.;
-                fh += std::max(flux0, 0.) * u_.oldField(0)(c) + std::min(flux0, 0.) * u_.oldField(0)(bd.face())
-                        + std::max(flux1, 0.) * u_.oldField(1)(c) + std::min(flux1, 0.) * u_.oldField(1)(bd.face());
-            }
-
-            fh -= rho_(c) * fb_(c) * c.volume();
-        }
-
-        fh = grid_->comm().sum(fh);
-
         Vector2D fw = ibObj->rho * ibObj->shape().area() * g_;
 
         if(grid_->comm().isMainProc())
@@ -437,3 +441,42 @@ void FractionalStepDirectForcingMultiphase::computeFieldExtenstions(Scalar timeS
     gradP_.faceToCell(rho_, rho_, *fluid_);
     gradP_.sendMessages();
 }
+
+void FractionalStepDirectForcingMultiphase::markRefinementCells(std::vector<bool> &refine) const
+{
+    FractionalStepDFIB::markRefinementCells(refine);
+
+    //- Interface cells, ignoring round-off away from the interface
+    for (const Cell &cell: *fluid_)
+        if (gamma_(cell) > 1e-6 && gamma_(cell) < 1. - 1e-6)
+            refine[cell.id()] = true;
+}
+
+void FractionalStepDirectForcingMultiphase::updateGridData()
+{
+    FractionalStepDFIB::updateGridData();
+    gammaEqn_.sparseSolver()->clearSolutions();
+
+    fst_->updateGrid();
+    computeCapillaryTimeStep();
+
+    gradGamma_.compute(*fluid_);
+    gradGamma_.sendMessages();
+    updateProperties(0.);
+}
+
+void FractionalStepDirectForcingMultiphase::computeCapillaryTimeStep()
+{
+    capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
+    for (const Face &face: grid_->interiorFaces())
+    {
+        Scalar delta = (face.rCell().centroid() - face.lCell().centroid()).mag();
+        capillaryTimeStep_ = std::min(
+                    capillaryTimeStep_,
+                    std::sqrt(
+                        (rho1_ + rho2_) * std::pow(delta, 3) / (4. * M_PI * fst_->sigma())
+                        ));
+    }
+
+    capillaryTimeStep_ = grid_->comm().min(capillaryTimeStep_);
+}
@@ -26,6 +26,8 @@ protected:
         Scalar gamma;
 
         Vector2D ncl, tcl;
+
+        Index ibObjId;
     };
 
     Scalar solveGammaEqn(Scalar timeStep);
@@ -42,6 +44,12 @@ protected:
 
     void computeFieldExtenstions(Scalar timeStep);
 
+    void markRefinementCells(std::vector<bool> &refine) const override;
+
+    void updateGridData() override;
+
+    void computeCapillaryTimeStep();
+
     Scalar rho1_, rho2_, mu1_, mu2_, capillaryTimeStep_;
 
     ScalarFiniteVolumeField &gamma_, &rho_, &mu_, &gammaSrc_, &divU_;
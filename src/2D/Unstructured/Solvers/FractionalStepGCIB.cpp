@@ -11,6 +11,9 @@ FractionalStepGCIB::FractionalStepGCIB(const Input &input, const std::shared_ptr
       ib_(input, grid, fluid_)
 {
     ib_.updateCells();
+
+    //- The ghost cell stencils are not rebuilt after a grid adaptation
+    adaptFrequency_ = 0;
 }
 
 Scalar FractionalStepGCIB::solve(Scalar timeStep)
@@ -20,8 +23,7 @@ Scalar FractionalStepGCIB::solve(Scalar timeStep)
     correctVelocity(timeStep);
     ib_.applyHydrodynamicForce(rho_, mu_, u_, p_);
 
-    grid_->comm().printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    grid_->comm().printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
 
     return 0;
 }
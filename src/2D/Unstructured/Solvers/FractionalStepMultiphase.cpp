@@ -27,15 +27,22 @@ FractionalStepMultiphase::FractionalStepMultiphase(const Input &input, const std
     mu1_ = input.caseInput().get<Scalar>("Properties.mu1", FractionalStep::mu_);
     mu2_ = input.caseInput().get<Scalar>("Properties.mu2", FractionalStep::mu_);
 
-    capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
-    for (const Face &face: grid_->interiorFaces())
-    {
-        Scalar delta = (face.rCell().centroid() - face.lCell().centroid()).mag();
-        capillaryTimeStep_ = std::min(capillaryTimeStep_,
-                                      sqrt(((rho1_ + rho2_) * delta * delta * delta) / (4. * M_PI * fst_.sigma())));
-    }
+    std::string gammaAdvection = input.caseInput().get<std::string>("Solver.gammaAdvection", "implicit");
 
-    capillaryTimeStep_ = grid_->comm().min(capillaryTimeStep_);
+    if (gammaAdvection != "implicit" && gammaAdvection != "explicit")
+        throw Exception("FractionalStepMultiphase", "FractionalStepMultiphase",
+                        "unrecognized gamma advection \"" + gammaAdvection + "\".");
+
+    //- The explicit update is only bounded for interface courant numbers below one
+    explicitGamma_ = gammaAdvection == "explicit";
+    maxGammaCo_ = input.caseInput().get<Scalar>("Solver.maxGammaCo", explicitGamma_ ? 0.5 : 0.);
+
+    //- Only the face values of the old properties are used, and the old momentum fluxes are recomputed every step
+    rho_.setHistoryData(ScalarFiniteVolumeField::FACE_DATA);
+    mu_.setHistoryData(ScalarFiniteVolumeField::FACE_DATA);
+    rhoU_.setHistoryData(VectorFiniteVolumeField::NO_DATA);
+
+    computeCapillaryTimeStep();
 
     addField(fst_.fst());
     addField(fst_.gammaTilde());
@@ -66,8 +73,8 @@ Scalar FractionalStepMultiphase::solve(Scalar timeStep)
     solvePEqn(timeStep);
     correctVelocity(timeStep);
 
-    printf("Max divergence error = %.4e\n", grid_->comm().max(maxDivergenceError()));
-    printf("Max CFL number = %.4lf\n", maxCourantNumber(timeStep));
+    reduceDiagnostics(timeStep);
+    adaptGrid();
 
     return 0;
 }
@@ -76,28 +83,71 @@ Scalar FractionalStepMultiphase::solve(Scalar timeStep)
 
 Scalar FractionalStepMultiphase::solveGammaEqn(Scalar timeStep)
 {
-    auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, timeStep);
+    //- Gamma is advected over the momentum step in sub-steps with the face velocities frozen
+    int nSubSteps = nGammaSubSteps(timeStep);
+    Scalar subStep = timeStep / nSubSteps, error = 0.;
 
-    //- Advect volume fractions
-    gamma_.savePreviousTimeStep(timeStep, 1);
-    gammaEqn_ = (fv::ddt(gamma_, timeStep) + cicsam::div(u_, gamma_, beta, 0.5) == 0.);
+    rhoU_.savePreviousTimeStep(timeStep, 2);
+    VectorFiniteVolumeField &rhoU0 = rhoU_.oldField(0), &rhoU1 = rhoU_.oldField(1);
 
-    Scalar error = gammaEqn_.solve();
-    gamma_.sendMessages();
-    gamma_.interpolateFaces();
+    for (int i = 0; i < nSubSteps; ++i)
+    {
+        auto beta = cicsam::faceInterpolationWeights(u_, gamma_, gradGamma_, subStep);
 
-    //- Update the gradient
-    gradGamma_.compute(*fluid_);
-    gradGamma_.sendMessages();
+        //- Advect volume fractions
+        gamma_.savePreviousTimeStep(subStep, 1);
 
-    //- Must be the exact momentum flux used to calculate gamma
-    rhoU_.savePreviousTimeStep(timeStep, 2);
-    cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_, beta, rhoU_.oldField(0));
-    cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma_.oldField(0), beta, rhoU_.oldField(1));
+        if (explicitGamma_)
+            cicsam::advect(u_, gamma_, beta, subStep, *fluid_);
+        else
+        {
+            gammaEqn_ = (fv::ddt(gamma_, subStep) + cicsam::div(u_, gamma_, beta, 0.5) == 0.);
+            error = std::max(error, gammaEqn_.solve());
+        }
+
+        gamma_.sendMessages();
+        gamma_.interpolateFaces();
+
+        //- Update the gradient
+        gradGamma_.compute(*fluid_);
+        gradGamma_.sendMessages();
+
+        //- Must be the exact momentum flux used to calculate gamma, averaged over the sub-steps. The explicit update only
+        //- uses the old gamma
+        auto average = [this, i, &beta](const ScalarFiniteVolumeField &gamma, VectorFiniteVolumeField &rhoU)
+        {
+            cicsam::computeMomentumFlux(rho1_, rho2_, u_, gamma, beta, rhoU_);
+
+            for (const Face &face: grid_->faces())
+                rhoU(face) = i == 0 ? rhoU_(face) : (i * rhoU(face) + rhoU_(face)) / (i + 1);
+        };
+
+        average(explicitGamma_ ? gamma_.oldField(0) : gamma_, rhoU0);
+        average(gamma_.oldField(0), rhoU1);
+    }
+
+    if (nSubSteps > 1)
+        grid_->comm().printf("Advected gamma in %d sub-steps.\n", nSubSteps);
 
     return error;
 }
 
+int FractionalStepMultiphase::nGammaSubSteps(Scalar timeStep) const
+{
+    if (maxGammaCo_ <= 0.)
+        return 1;
+
+    //- Only the cells around the interface limit the sub-step, gamma is uniform everywhere else
+    auto co = cicsam::cellCourantNumbers(u_, timeStep);
+    Scalar maxCo = 0.;
+
+    for (const Face &face: grid_->interiorFaces())
+        if (std::abs(gamma_(face.lCell()) - gamma_(face.rCell())) > 1e-6)
+            maxCo = std::max(maxCo, std::max(co[face.lCell().id()], co[face.rCell().id()]));
+
+    return std::max(1, (int) std::ceil(grid_->comm().max(maxCo) / maxGammaCo_));
+}
+
 Scalar FractionalStepMultiphase::solveUEqn(Scalar timeStep)
 {
     u_.savePreviousTimeStep(timeStep, 2);
@@ -213,3 +263,38 @@ void FractionalStepMultiphase::updateProperties(Scalar timeStep)
     //- Must be communicated for proper momentum interpolation
     fst_.fst()->sendMessages();
 }
+
+void FractionalStepMultiphase::markRefinementCells(std::vector<bool> &refine) const
+{
+    FractionalStep::markRefinementCells(refine);
+
+    //- Interface cells, ignoring round-off away from the interface
+    for (const Cell &cell: *fluid_)
+        if (gamma_(cell) > 1e-6 && gamma_(cell) < 1. - 1e-6)
+            refine[cell.id()] = true;
+}
+
+void FractionalStepMultiphase::updateGridData()
+{
+    FractionalStep::updateGridData();
+    gammaEqn_.sparseSolver()->clearSolutions();
+
+    fst_.updateGrid();
+    computeCapillaryTimeStep();
+
+    gradGamma_.compute(*fluid_);
+    updateProperties(0.);
+}
+
+void FractionalStepMultiphase::computeCapillaryTimeStep()
+{
+    capillaryTimeStep_ = std::numeric_limits<Scalar>::infinity();
+    for (const Face &face: grid_->interiorFaces())
+    {
+        Scalar delta = (face.rCell().centroid() - face.lCell().centroid()).mag();
+        capillaryTimeStep_ = std::min(capillaryTimeStep_,
+                                      sqrt(((rho1_ + rho2_) * delta * delta * delta) / (4. * M_PI * fst_.sigma())));
+    }
+
+    capillaryTimeStep_ = grid_->comm().min(capillaryTimeStep_);
+}
@@ -20,6 +20,9 @@ protected:
 
     virtual Scalar solveGammaEqn(Scalar timeStep);
 
+    //- Number of gamma sub-steps needed to keep the interface Courant number below maxGammaCo_
+    int nGammaSubSteps(Scalar timeStep) const;
+
     virtual Scalar solveUEqn(Scalar timeStep);
 
     virtual Scalar solvePEqn(Scalar timeStep);
@@ -28,9 +31,22 @@ protected:
 
     virtual void updateProperties(Scalar timeStep);
 
+    void markRefinementCells(std::vector<bool> &refine) const override;
+
+    void updateGridData() override;
+
+    //- Stability limit of the explicit surface tension on the current grid
+    void computeCapillaryTimeStep();
+
     //- Properties
     Scalar rho1_, rho2_, mu1_, mu2_, capillaryTimeStep_;
 
+    //- Courant number limit of a gamma sub-step, sub-cycling is off if zero
+    Scalar maxGammaCo_;
+
+    //- Bounded explicit gamma advection instead of the implicit gamma equation
+    bool explicitGamma_;
+
     //- Fields
     ScalarFiniteVolumeField &rho_, &mu_, &gamma_, &beta_;
 
@@ -568,3 +568,41 @@ void Solver::restartSolution(const Input &input)
 
     file.close();
 }
+
+void Solver::projectFields(const std::vector<std::vector<std::pair<Label, Scalar>>> &projection)
+{
+    scalarIndexMap_->init(*grid_, 1);
+    vectorIndexMap_->init(*grid_, 2);
+
+    for (const auto &entry: integerFields_)
+        entry.second->project(projection);
+
+    for (const auto &entry: scalarFields_)
+    {
+        entry.second->project(projection);
+
+        if (entry.second->hasFaces())
+            interpolateProjectedFaces(*entry.second);
+    }
+
+    for (const auto &entry: vectorFields_)
+    {
+        entry.second->project(projection);
+
+        if (entry.second->hasFaces())
+            interpolateProjectedFaces(*entry.second);
+    }
+
+    for (const auto &entry: tensorFields_)
+        entry.second->project(projection);
+}
+
+template<class T>
+void Solver::interpolateProjectedFaces(FiniteVolumeField<T> &field)
+{
+    field.interpolateFaces();
+
+    //- Old face values enter the explicit parts of the next step
+    for (int i = 0; i < field.nPreviousTimeSteps(); ++i)
+        field.oldField(i).interpolateFaces();
+}
@@ -105,6 +105,13 @@ protected:
 
     virtual void restartSolution(const Input &input);
 
+    //- Projects every registered field onto an adapted grid and rebuilds the index maps. Face values of every time
+    //- level are interpolated from the projected cells
+    void projectFields(const std::vector<std::vector<std::pair<Label, Scalar>>> &projection);
+
+    template<class T>
+    static void interpolateProjectedFaces(FiniteVolumeField<T> &field);
+
     std::shared_ptr<const FiniteVolumeGrid2D> grid_;
 
     std::shared_ptr<IndexMap> scalarIndexMap_, vectorIndexMap_;
@@ -0,0 +1,247 @@
+#include <fstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "System/CommandLine.h"
+#include "System/Timer.h"
+#include "Math/SparseMatrixSolverFactory.h"
+
+#include "FiniteVolumeGrid2D/StructuredRectilinearGrid.h"
+#include "FiniteVolumeGrid2D/CgnsUnstructuredGrid.h"
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2DFactory.h"
+#include "FiniteVolume/Equation/IndexMap.h"
+#include "FiniteVolume/Discretization/Laplacian.h"
+#include "FiniteVolume/Discretization/Divergence.h"
+#include "FiniteVolume/Discretization/Cicsam.h"
+#include "FiniteVolume/Multiphase/Celeste.h"
+
+//- Times the core finite volume kernels in isolation. Run from a case directory, the grid is either generated
+//- (--nx, --ny), loaded from a cgns file (--cgns-grid) or taken from the case input.
+
+struct KernelTiming
+{
+    std::string name;
+    Scalar min, mean, max;
+};
+
+//- The setup runs untimed before every call of the kernel, for kernels that modify their inputs
+template<class Setup, class Kernel>
+KernelTiming timeKernel(const std::string &name, int nRepeats, const Communicator &comm, Setup setup, Kernel kernel)
+{
+    comm.printf("Timing kernel \"%s\"...\n", name.c_str());
+
+    //- Warm-up, so that first touch allocations are not timed
+    setup();
+    kernel();
+
+    KernelTiming timing{name, std::numeric_limits<Scalar>::infinity(), 0., 0.};
+    Timer timer;
+
+    for (int i = 0; i < nRepeats; ++i)
+    {
+        setup();
+        comm.barrier();
+        timer.start();
+        kernel();
+        timer.stop();
+
+        //- The slowest process determines the kernel time
+        Scalar time = comm.max(timer.elapsedSeconds());
+
+        timing.min = std::min(timing.min, time);
+        timing.max = std::max(timing.max, time);
+        timing.mean += time / nRepeats;
+    }
+
+    return timing;
+}
+
+template<class Kernel>
+KernelTiming timeKernel(const std::string &name, int nRepeats, const Communicator &comm, Kernel kernel)
+{
+    return timeKernel(name, nRepeats, comm, []() {}, kernel);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace std;
+
+    Communicator::init(argc, argv);
+
+    CommandLine cl;
+
+    cl.addOptions()
+            ("nx", boost::program_options::value<int>()->default_value(0), "number of cells in x of a generated rectilinear grid")
+            ("ny", boost::program_options::value<int>()->default_value(0), "number of cells in y of a generated rectilinear grid")
+            ("cgns-grid", boost::program_options::value<std::string>()->default_value(""), "cgns grid file to load instead of the case grid")
+            ("repeats", boost::program_options::value<int>()->default_value(10), "number of timed repetitions per kernel")
+            ("solvers", boost::program_options::value<std::string>()->default_value("eigen,belos,amesos2"), "comma separated sparse solver backends to time")
+            ("output", boost::program_options::value<std::string>()->default_value("benchmark.json"), "json output file");
+
+    cl.parseArguments(argc, argv);
+
+    Input input;
+    input.parseInputFile();
+
+    const Communicator comm;
+
+    //- Grid
+    std::shared_ptr<FiniteVolumeGrid2D> grid;
+    std::string gridType;
+
+    if (!cl.get<std::string>("cgns-grid").empty())
+    {
+        auto cgnsGrid = std::make_shared<CgnsUnstructuredGrid>();
+        cgnsGrid->load(cl.get<std::string>("cgns-grid"), Point2D(0., 0.));
+        cgnsGrid->partition(input);
+        grid = cgnsGrid;
+        gridType = "cgns";
+    }
+    else if (cl.get<int>("nx") > 0)
+    {
+        int nx = cl.get<int>("nx");
+        int ny = cl.get<int>("ny") > 0 ? cl.get<int>("ny") : nx;
+        grid = std::make_shared<StructuredRectilinearGrid>(1., Scalar(ny) / nx, nx, ny);
+        grid->partition(input);
+        gridType = "rectilinear";
+    }
+    else
+    {
+        grid = FiniteVolumeGrid2DFactory::create(input);
+        gridType = input.caseInput().get<std::string>("Grid.type");
+    }
+
+    int nRepeats = cl.get<int>("repeats");
+    std::string outputFile = cl.get<std::string>("output");
+
+    std::vector<std::string> solvers;
+    boost::split(solvers, cl.get<std::string>("solvers"), boost::is_any_of(","));
+
+    //- Fields
+    auto cells = std::make_shared<CellGroup>(grid->localCells().begin(), grid->localCells().end(), "benchmark");
+    auto indexMap = std::make_shared<IndexMap>(*grid, 1);
+
+    ScalarFiniteVolumeField p(input, grid, "p", 0., true, false, cells, indexMap);
+    ScalarFiniteVolumeField gamma(input, grid, "gamma", 0., true, false, cells, indexMap);
+    VectorFiniteVolumeField u(input, grid, "u", Vector2D(0., 0.), true, false, cells);
+    ScalarGradient gradGamma(gamma, cells);
+
+    //- Smooth, non-trivial data so that the kernels exercise all branches
+    for (const Cell &cell: grid->cells())
+    {
+        const Point2D &x = cell.centroid();
+        p(cell) = std::sin(2. * M_PI * x.x) * std::sin(2. * M_PI * x.y);
+        gamma(cell) = 0.5 * (1. + std::tanh((0.25 - (x - Point2D(0.5, 0.5)).mag()) / 0.02));
+        u(cell) = Vector2D(-std::sin(M_PI * x.x) * std::cos(M_PI * x.y), std::cos(M_PI * x.x) * std::sin(M_PI * x.y));
+    }
+
+    p.setBoundaryFaces();
+    gamma.setBoundaryFaces();
+    u.interpolateFaces();
+
+    Scalar timeStep = 1e-3;
+    u.savePreviousTimeStep(timeStep, 1);
+    gamma.savePreviousTimeStep(timeStep, 1);
+    gradGamma.compute(*cells);
+
+    std::vector<KernelTiming> timings;
+
+    timings.push_back(timeKernel("fv::laplacian", nRepeats, comm, [&]() { fv::laplacian(1., p); }));
+
+    timings.push_back(timeKernel("fv::div", nRepeats, comm, [&]() { fv::div(u, gamma, 0.5); }));
+
+    timings.push_back(timeKernel("ScalarGradient::compute", nRepeats, comm, [&]() { gradGamma.compute(*cells); }));
+
+    timings.push_back(timeKernel("cicsam::faceInterpolationWeights", nRepeats, comm, [&]()
+    {
+        cicsam::faceInterpolationWeights(u, gamma, gradGamma, timeStep);
+    }));
+
+    if (input.caseInput().get_optional<Scalar>("Properties.sigma"))
+    {
+        Celeste celeste(input, grid, cells);
+
+        timings.push_back(timeKernel("Celeste::computeInterfaceForces", nRepeats, comm, [&]()
+        {
+            celeste.computeInterfaceForces(gamma, gradGamma);
+        }));
+    }
+    else
+        comm.printf("Skipping Celeste, \"Properties.sigma\" is not set in the case input.\n");
+
+    const FiniteVolumeEquation<Scalar> lapEqn0 = fv::laplacian(1., gamma);
+    FiniteVolumeEquation<Scalar> lapEqn = lapEqn0, divEqn = fv::div(u, gamma, 0.5);
+
+    //- Every repetition adds to a fresh copy, otherwise the sum keeps growing
+    timings.push_back(timeKernel("CrsEquation::operator+=", nRepeats, comm,
+                                 [&]() { lapEqn = lapEqn0; },
+                                 [&]() { lapEqn += divEqn; }));
+
+    timings.push_back(timeKernel("FiniteVolumeGrid2D::sendMessages", nRepeats, comm, [&]() { grid->sendMessages(p); }));
+
+    //- Pressure Poisson problem with the pressure level pinned in the first cell. It is assembled once, only handing
+    //- the system to the solver and the solve itself are timed
+    FiniteVolumeEquation<Scalar> pEqn = fv::laplacian(1., p);
+
+    for (const Cell &cell: *cells)
+        pEqn.addSource(cell, std::sin(2. * M_PI * cell.centroid().x) * cell.volume());
+
+    if (comm.isMainProc() && !cells->empty())
+        pEqn.add((*cells)[0], (*cells)[0], pEqn.get((*cells)[0], (*cells)[0]));
+
+    Vector pRhs(pEqn.rank(), 0.), pGuess(pEqn.rank(), 0.);
+
+    for (Index i = 0; i < pEqn.rank(); ++i)
+        pRhs(i) = -pEqn.b(i);
+
+    for (const std::string &lib: solvers)
+    {
+        auto solver = SparseMatrixSolverFactory().create(lib, comm);
+
+        if (comm.nProcs() > 1 && !solver->supportsMPI())
+        {
+            comm.printf("Skipping solver \"%s\", it does not support multiple processes.\n", lib.c_str());
+            continue;
+        }
+
+        auto parameters = input.caseInput().get_child_optional("Benchmark." + lib);
+        solver->setup(parameters ? *parameters : boost::property_tree::ptree());
+
+        timings.push_back(timeKernel("SparseMatrixSolver::solve (" + lib + ")", nRepeats, comm, [&]()
+        {
+            solver->setRank(pEqn.rank());
+            solver->setLocal(pEqn.rowPtr(), pEqn.colInd(), pEqn.vals(), p.indexMap()->columnGlobalIndices());
+            solver->setRhs(pRhs);
+            solver->setGuess(pGuess);
+            solver->solve();
+        }));
+    }
+
+    //- Output
+    unsigned long nCells = comm.sum((unsigned long) grid->localCells().size());
+
+    if (comm.isMainProc())
+    {
+        std::ofstream fout(outputFile);
+
+        fout << "{\n"
+             << "  \"grid\": {\"type\": \"" << gridType << "\", \"nCells\": " << nCells << "},\n"
+             << "  \"nProcs\": " << comm.nProcs() << ",\n"
+             << "  \"repeats\": " << nRepeats << ",\n"
+             << "  \"kernels\": [\n";
+
+        for (int i = 0; i < timings.size(); ++i)
+        {
+            const KernelTiming &t = timings[i];
+            fout << "    {\"name\": \"" << t.name << "\", \"min\": " << t.min << ", \"mean\": " << t.mean
+                 << ", \"max\": " << t.max << "}" << (i + 1 < timings.size() ? ",\n" : "\n");
+        }
+
+        fout << "  ]\n"
+             << "}\n";
+    }
+
+    comm.printf("Benchmark results written to \"%s\".\n", outputFile.c_str());
+
+    Communicator::finalize();
+}
@@ -0,0 +1,100 @@
+#include <fstream>
+
+#include "System/CommandLine.h"
+#include "System/Timer.h"
+
+#include "FiniteVolumeGrid2D/StructuredRectilinearGrid.h"
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2DFactory.h"
+#include "Solvers/SolverFactory.h"
+
+//- Runs the solver of a case for a fixed number of time steps and writes per-step wall times as json. Used by the
+//- weak/strong scaling driver, which controls the grid size through --nx and --ny.
+
+int main(int argc, char *argv[])
+{
+    using namespace std;
+
+    Communicator::init(argc, argv);
+
+    CommandLine cl;
+
+    cl.addOptions()
+            ("nx", boost::program_options::value<int>()->default_value(0), "override the number of cells in x of a rectilinear case grid")
+            ("ny", boost::program_options::value<int>()->default_value(0), "override the number of cells in y of a rectilinear case grid")
+            ("steps", boost::program_options::value<int>()->default_value(10), "number of time steps to run")
+            ("output", boost::program_options::value<std::string>()->default_value("scaling.json"), "json output file");
+
+    cl.parseArguments(argc, argv);
+
+    Input input;
+    input.parseInputFile();
+
+    std::shared_ptr<FiniteVolumeGrid2D> grid;
+
+    if (cl.get<int>("nx") > 0)
+    {
+        if (input.caseInput().get<std::string>("Grid.type") != "rectilinear")
+            throw Exception("Phase2DUnstructuredScaling", "main", "--nx and --ny require a rectilinear case grid.");
+
+        int nx = cl.get<int>("nx");
+        int ny = cl.get<int>("ny") > 0 ? cl.get<int>("ny") : nx;
+
+        grid = std::make_shared<StructuredRectilinearGrid>(input.caseInput().get<Scalar>("Grid.width"),
+                                                           input.caseInput().get<Scalar>("Grid.height"),
+                                                           nx, ny,
+                                                           input.caseInput().get<std::string>("Grid.origin", "(0,0)"));
+        grid->partition(input);
+    }
+    else
+        grid = FiniteVolumeGrid2DFactory::create(input);
+
+    std::shared_ptr<Solver> solver = SolverFactory::create(input, grid);
+
+    solver->setInitialConditions(input);
+    solver->initialize();
+
+    int nSteps = cl.get<int>("steps");
+    Scalar maxCo = input.caseInput().get<Scalar>("Solver.maxCo");
+    Scalar timeStep = input.caseInput().get<Scalar>("Solver.initialTimeStep", solver->maxTimeStep());
+
+    std::vector<Scalar> stepTimes;
+    Timer timer, totalTimer;
+
+    totalTimer.start();
+    for (int i = 0; i < nSteps; ++i)
+    {
+        solver->comm().barrier();
+        timer.start();
+        solver->solve(timeStep);
+        timer.stop();
+
+        stepTimes.push_back(solver->comm().max(timer.elapsedSeconds()));
+        timeStep = solver->computeMaxTimeStep(maxCo, timeStep);
+    }
+    totalTimer.stop();
+
+    unsigned long nCells = solver->comm().sum((unsigned long) grid->localCells().size());
+
+    if (solver->comm().isMainProc())
+    {
+        std::ofstream fout(cl.get<std::string>("output"));
+
+        fout << "{\n"
+             << "  \"case\": \"" << input.caseInput().get<std::string>("CaseName", "") << "\",\n"
+             << "  \"nProcs\": " << solver->comm().nProcs() << ",\n"
+             << "  \"nCells\": " << nCells << ",\n"
+             << "  \"nSteps\": " << nSteps << ",\n"
+             << "  \"totalTime\": " << totalTimer.elapsedSeconds() << ",\n"
+             << "  \"stepTimes\": [";
+
+        for (int i = 0; i < stepTimes.size(); ++i)
+            fout << stepTimes[i] << (i + 1 < stepTimes.size() ? ", " : "");
+
+        fout << "]\n"
+             << "}\n";
+    }
+
+    solver->printf("Scaling results written to \"%s\".\n", cl.get<std::string>("output").c_str());
+
+    Communicator::finalize();
+}
@@ -15,6 +15,7 @@ int main(int argc, char *argv[])
 
     cl.addSwitch("restart,r", "restart the solution from the latest time point");
     cl.addSwitch("use-partitioned-grid,g", "use the pre-partitioned grid");
+    cl.addSwitch("use-preprocessed-grid,b", "use the preprocessed binary grid");
 
     cl.parseArguments(argc, argv);
 
@@ -0,0 +1,37 @@
+#include <boost/filesystem.hpp>
+
+#include "System/Input.h"
+#include "System/CommandLine.h"
+
+#include "FiniteVolumeGrid2D/FiniteVolumeGrid2DFactory.h"
+#include "FiniteVolumeGrid2D/PreprocessedGrid.h"
+
+//- Builds and partitions the case grid once and writes one preprocessed binary grid per process. Must be run with
+//- the same number of processes as the runs that use the grid, which then start with --use-preprocessed-grid.
+
+int main(int argc, char *argv[])
+{
+    Communicator::init(argc, argv);
+
+    CommandLine cl;
+    cl.parseArguments(argc, argv);
+
+    Input input;
+    input.parseInputFile();
+
+    auto grid = FiniteVolumeGrid2DFactory::create(input);
+
+    std::string filename = FiniteVolumeGrid2DFactory::preprocessedGridFilename(grid->comm().rank());
+
+    //- Make sure the output directory is available
+    boost::filesystem::create_directories(boost::filesystem::path(filename).parent_path());
+
+    grid->comm().printf("Writing preprocessed grids...\n");
+
+    PreprocessedGrid::write(filename, *grid);
+
+    grid->comm().barrier();
+    grid->comm().printf("Finished writing preprocessed grids for %d processes.\n", grid->comm().nProcs());
+
+    Communicator::finalize();
+}
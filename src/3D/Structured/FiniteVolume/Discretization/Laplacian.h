@@ -1,13 +1,17 @@
 #ifndef PHASE_LAPLACIAN_H
 #define PHASE_LAPLACIAN_H
 
+#include "Math/StructuredStencilOperator.h"
 #include "Structured/FiniteVolume/Equation/FiniteVolumeEquation.h"
 
 namespace fv
 {
 
 template<class T>
-FiniteVolumeEquation<T> lap(Field<T> &phi);
+FiniteVolumeEquation<T> lap(Scalar gamma, Field<T> &phi);
+
+//- Matrix-free equivalent of lap on the uniform grid, with the same zero gradient boundaries
+StructuredStencilOperator lapOperator(Scalar gamma, const Field<Scalar> &phi);
 
 }
 
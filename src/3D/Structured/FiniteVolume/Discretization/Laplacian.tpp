@@ -27,4 +27,11 @@ FiniteVolumeEquation<T> lap(Scalar gamma, Field<T> &phi)
     return eqn;
 }
 
+inline StructuredStencilOperator lapOperator(Scalar gamma, const Field<Scalar> &phi)
+{
+    const StructuredGrid3D &grid = *phi.grid();
+
+    return StructuredStencilOperator(grid.decomposition(), grid.dx(), grid.dy(), grid.dz(), gamma);
+}
+
 }
@@ -0,0 +1,66 @@
+#include "StencilKernels.h"
+
+namespace fv
+{
+
+void laplacian(int order, Scalar gamma, const Field<Scalar> &phi, Field<Scalar> &result)
+{
+    switch (order)
+    {
+    case 2:
+        laplacian<2>(gamma, phi, result);
+        break;
+    case 4:
+        laplacian<4>(gamma, phi, result);
+        break;
+    default:
+        throw Exception("fv", "laplacian", "unsupported stencil order " + std::to_string(order) + ".");
+    }
+}
+
+void residual(int order, Scalar gamma, const Field<Scalar> &phi, const Field<Scalar> &b, Field<Scalar> &r)
+{
+    switch (order)
+    {
+    case 2:
+        residual<2>(gamma, phi, b, r);
+        break;
+    case 4:
+        residual<4>(gamma, phi, b, r);
+        break;
+    default:
+        throw Exception("fv", "residual", "unsupported stencil order " + std::to_string(order) + ".");
+    }
+}
+
+void gradient(int order, const Field<Scalar> &phi, Field<Vector3D> &result)
+{
+    switch (order)
+    {
+    case 2:
+        gradient<2>(phi, result);
+        break;
+    case 4:
+        gradient<4>(phi, result);
+        break;
+    default:
+        throw Exception("fv", "gradient", "unsupported stencil order " + std::to_string(order) + ".");
+    }
+}
+
+void divergence(int order, const Field<Vector3D> &u, Field<Scalar> &result)
+{
+    switch (order)
+    {
+    case 2:
+        divergence<2>(u, result);
+        break;
+    case 4:
+        divergence<4>(u, result);
+        break;
+    default:
+        throw Exception("fv", "divergence", "unsupported stencil order " + std::to_string(order) + ".");
+    }
+}
+
+}
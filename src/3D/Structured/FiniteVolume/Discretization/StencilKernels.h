@@ -0,0 +1,131 @@
+#ifndef PHASE_STENCIL_KERNELS_H
+#define PHASE_STENCIL_KERNELS_H
+
+#include "Geometry/Point3D.h"
+#include "Structured/FiniteVolume/Field/Field.h"
+
+//- Explicit finite volume operators evaluated directly on the padded cell arrays of structured fields. Cells are
+//- swept in unit stride i rows so that the inner loops vectorize. The stencil order is a template parameter, giving
+//- specialized kernels for each order supported by Cell::initStencils. Ghost layers must be current
+//- (Field::sendMessages) and at least Order / 2 deep. Domain boundary faces have zero gradient, as in fv::lap.
+namespace fv
+{
+
+//- Face normal derivative and face interpolation weights on a uniform grid of unit spacing. A stencil with shift s
+//- covers the cells s - radius + 1, ..., s + radius relative to the cell below the face, stencils are shifted away from
+//- domain boundaries so that the order is kept, in the same way as FaceStencil
+template<int Order>
+struct FaceDerivative;
+
+template<int Order>
+struct FaceInterpolation;
+
+template<>
+struct FaceDerivative<2>
+{
+    typedef FaceDerivative<2> LowOrder;
+
+    static const int radius = 1;
+
+    static Scalar weight(int shift, int m)
+    {
+        static const Scalar w[1][2] = {{-1., 1.}};
+        return w[shift][m];
+    }
+
+    //- Weight of the inside cell on a domain boundary face
+    static Scalar boundaryWeight()
+    { return 0.; }
+};
+
+template<>
+struct FaceDerivative<4>
+{
+    typedef FaceDerivative<2> LowOrder;
+
+    static const int radius = 2;
+
+    static Scalar weight(int shift, int m)
+    {
+        static const Scalar w[3][4] = {
+            {1. / 24., -3. / 24., -21. / 24., 23. / 24.},
+            {1. / 24., -27. / 24., 27. / 24., -1. / 24.},
+            {-23. / 24., 21. / 24., 3. / 24., -1. / 24.}
+        };
+
+        return w[shift + 1][m];
+    }
+
+    static Scalar boundaryWeight()
+    { return 0.; }
+};
+
+template<>
+struct FaceInterpolation<2>
+{
+    typedef FaceInterpolation<2> LowOrder;
+
+    static const int radius = 1;
+
+    static Scalar weight(int shift, int m)
+    {
+        static const Scalar w[1][2] = {{0.5, 0.5}};
+        return w[shift][m];
+    }
+
+    static Scalar boundaryWeight()
+    { return 1.; }
+};
+
+template<>
+struct FaceInterpolation<4>
+{
+    typedef FaceInterpolation<2> LowOrder;
+
+    static const int radius = 2;
+
+    static Scalar weight(int shift, int m)
+    {
+        static const Scalar w[3][4] = {
+            {1. / 16., -5. / 16., 15. / 16., 5. / 16.},
+            {-1. / 16., 9. / 16., 9. / 16., -1. / 16.},
+            {5. / 16., 15. / 16., -5. / 16., 1. / 16.}
+        };
+
+        return w[shift + 1][m];
+    }
+
+    static Scalar boundaryWeight()
+    { return 1.; }
+};
+
+//- Volume integrated div(gamma grad(phi))
+template<int Order>
+void laplacian(Scalar gamma, const Field<Scalar> &phi, Field<Scalar> &result);
+
+//- r = b - laplacian(gamma, phi)
+template<int Order>
+void residual(Scalar gamma, const Field<Scalar> &phi, const Field<Scalar> &b, Field<Scalar> &r);
+
+//- Cell averaged Gauss gradient
+template<int Order>
+void gradient(const Field<Scalar> &phi, Field<Vector3D> &result);
+
+//- Volume integrated div(u)
+template<int Order>
+void divergence(const Field<Vector3D> &u, Field<Scalar> &result);
+
+//- Runtime order selection, as given to Cell::initStencils
+void laplacian(int order, Scalar gamma, const Field<Scalar> &phi, Field<Scalar> &result);
+
+void residual(int order, Scalar gamma, const Field<Scalar> &phi, const Field<Scalar> &b, Field<Scalar> &r);
+
+void gradient(int order, const Field<Scalar> &phi, Field<Vector3D> &result);
+
+void divergence(int order, const Field<Vector3D> &u, Field<Scalar> &result);
+
+}
+
+#include "StencilKernels.tpp"
+
+#endif
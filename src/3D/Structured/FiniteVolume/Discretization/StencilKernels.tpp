@@ -0,0 +1,239 @@
+#include <algorithm>
+
+#include "System/Exception.h"
+
+#include "StencilKernels.h"
+
+namespace fv
+{
+
+namespace detail
+{
+
+struct FaceType
+{
+    enum Kind
+    {
+        INTERIOR, LOW_ORDER, LOWER_BOUNDARY, UPPER_BOUNDARY
+    };
+
+    Kind kind;
+    int shift;
+
+    bool operator==(const FaceType &rhs) const
+    { return kind == rhs.kind && shift == rhs.shift; }
+};
+
+//- Type of the face between local cells a and a + 1 along dir
+inline FaceType faceType(const CartesianDecomposition &decomp, CartesianDecomposition::Direction dir, Index a, int radius)
+{
+    auto lower = CartesianDecomposition::Side(2 * dir), upper = CartesianDecomposition::Side(2 * dir + 1);
+    Index n = decomp.nLocal(dir);
+
+    if (a < 0 && !decomp.hasNeighbour(lower))
+        return FaceType{FaceType::LOWER_BOUNDARY, 0};
+
+    if (a == n - 1 && !decomp.hasNeighbour(upper))
+        return FaceType{FaceType::UPPER_BOUNDARY, 0};
+
+    //- Shift the stencil back into the available cells
+    Index lo = -(Index) decomp.nGhost(lower), hi = n - 1 + (Index) decomp.nGhost(upper);
+    Index shift = std::max(lo - (a - radius + 1), (Index) 0) - std::max(a + radius - hi, (Index) 0);
+
+    if (a + shift - radius + 1 < lo || a + shift + radius > hi)
+        return FaceType{FaceType::LOW_ORDER, 0};
+
+    return FaceType{FaceType::INTERIOR, (int) shift};
+}
+
+//- out[c] += coeff * (stencil value on the face above cell c + offset), for n consecutive cells from c0
+template<class Weights, int NIn, int NOut>
+void addStencilValues(Scalar *out, const Scalar *x, Index c0, Index n, Index s, Index offset, int shift, Scalar coeff)
+{
+    const int r = Weights::radius;
+
+    Scalar w[2 * r];
+    for (int m = 0; m < 2 * r; ++m)
+        w[m] = coeff * Weights::weight(shift, m);
+
+    offset += (shift - r + 1) * s;
+
+#pragma omp simd
+    for (Index c = c0; c < c0 + n; ++c)
+    {
+        Scalar val = 0.;
+
+        for (int m = 0; m < 2 * r; ++m)
+            val += w[m] * x[(c + offset + m * s) * NIn];
+
+        out[c * NOut] += val;
+    }
+}
+
+template<class Weights, int NIn, int NOut>
+void addFaceValues(Scalar *out, const Scalar *x, Index c0, Index n, Index s, Index offset, FaceType type, Scalar coeff)
+{
+    //- The type is the same for all n faces, so the branch is outside of the vectorized loops
+    switch (type.kind)
+    {
+    case FaceType::INTERIOR:
+        addStencilValues<Weights, NIn, NOut>(out, x, c0, n, s, offset, type.shift, coeff);
+        break;
+
+    case FaceType::LOW_ORDER:
+        addStencilValues<typename Weights::LowOrder, NIn, NOut>(out, x, c0, n, s, offset, 0, coeff);
+        break;
+
+    case FaceType::LOWER_BOUNDARY:
+        //- The inside cell is above the face
+        coeff *= Weights::boundaryWeight();
+
+#pragma omp simd
+        for (Index c = c0; c < c0 + n; ++c)
+            out[c * NOut] += coeff * x[(c + offset + s) * NIn];
+        break;
+
+    case FaceType::UPPER_BOUNDARY:
+        coeff *= Weights::boundaryWeight();
+
+#pragma omp simd
+        for (Index c = c0; c < c0 + n; ++c)
+            out[c * NOut] += coeff * x[(c + offset) * NIn];
+        break;
+    }
+}
+
+struct Segment
+{
+    Index begin, end;
+    FaceType type;
+};
+
+//- Face types along the i rows only change near the ends, so rows are split into a few segments of constant type
+inline std::vector<Segment> rowSegments(const CartesianDecomposition &decomp, Index offset, int radius)
+{
+    std::vector<Segment> segments;
+    Index n = decomp.nLocal(CartesianDecomposition::I);
+
+    for (Index i = 0; i < n; ++i)
+    {
+        FaceType type = faceType(decomp, CartesianDecomposition::I, i + offset, radius);
+
+        if (segments.empty() || !(segments.back().type == type))
+            segments.push_back(Segment{i, i + 1, type});
+        else
+            segments.back().end = i + 1;
+    }
+
+    return segments;
+}
+
+//- out_d[c] += coeffs[d] * (F_d(face above c) - F_d(face below c)) summed over the directions d, where F_d are the face
+//- values of the component array x[d]
+template<class Weights, int NIn, int NOut>
+void addFaceDifferences(const StructuredGrid3D &grid,
+                        const std::array<const Scalar *, 3> &x,
+                        const std::array<Scalar *, 3> &out,
+                        const std::array<Scalar, 3> &coeffs)
+{
+    const CartesianDecomposition &decomp = *grid.decomposition();
+    const int r = Weights::radius;
+
+    for (int side = 0; side < 6; ++side)
+        if (decomp.hasNeighbour(CartesianDecomposition::Side(side)) && decomp.nGhost() < r)
+            throw Exception("fv", "addFaceDifferences", "grid does not have enough ghost layers for the stencil order.");
+
+    Index ni = grid.nCellsI(), nj = grid.nCellsJ(), nk = grid.nCellsK();
+    Index sJ = decomp.arrayExtent(CartesianDecomposition::I);
+    Index sK = sJ * decomp.arrayExtent(CartesianDecomposition::J);
+
+    std::vector<Segment> upperI = rowSegments(decomp, 0, r), lowerI = rowSegments(decomp, -1, r);
+
+#pragma omp parallel for
+    for (Index jk = 0; jk < nj * nk; ++jk)
+    {
+        Index j = jk % nj, k = jk / nj;
+        Index c0 = decomp.index(0, j, k);
+
+        for (const Segment &seg: upperI)
+            addFaceValues<Weights, NIn, NOut>(out[0], x[0], c0 + seg.begin, seg.end - seg.begin, 1, 0, seg.type, coeffs[0]);
+
+        for (const Segment &seg: lowerI)
+            addFaceValues<Weights, NIn, NOut>(out[0], x[0], c0 + seg.begin, seg.end - seg.begin, 1, -1, seg.type, -coeffs[0]);
+
+        addFaceValues<Weights, NIn, NOut>(out[1], x[1], c0, ni, sJ, 0,
+                faceType(decomp, CartesianDecomposition::J, j, r), coeffs[1]);
+
+        addFaceValues<Weights, NIn, NOut>(out[1], x[1], c0, ni, sJ, -sJ,
+                faceType(decomp, CartesianDecomposition::J, j - 1, r), -coeffs[1]);
+
+        addFaceValues<Weights, NIn, NOut>(out[2], x[2], c0, ni, sK, 0,
+                faceType(decomp, CartesianDecomposition::K, k, r), coeffs[2]);
+
+        addFaceValues<Weights, NIn, NOut>(out[2], x[2], c0, ni, sK, -sK,
+                faceType(decomp, CartesianDecomposition::K, k - 1, r), -coeffs[2]);
+    }
+}
+
+}
+
+template<int Order>
+void laplacian(Scalar gamma, const Field<Scalar> &phi, Field<Scalar> &result)
+{
+    const StructuredGrid3D &grid = *phi.grid();
+    Scalar dx = grid.dx(), dy = grid.dy(), dz = grid.dz();
+
+    std::fill(result.cellData().begin(), result.cellData().end(), 0.);
+
+    const Scalar *x = phi.cellData().data();
+    Scalar *y = result.cellData().data();
+
+    detail::addFaceDifferences<FaceDerivative<Order>, 1, 1>(grid, {{x, x, x}}, {{y, y, y}},
+                                                            {{gamma * dy * dz / dx, gamma * dx * dz / dy, gamma * dx * dy / dz}});
+}
+
+template<int Order>
+void residual(Scalar gamma, const Field<Scalar> &phi, const Field<Scalar> &b, Field<Scalar> &r)
+{
+    const StructuredGrid3D &grid = *phi.grid();
+    Scalar dx = grid.dx(), dy = grid.dy(), dz = grid.dz();
+
+    std::copy(b.cellData().begin(), b.cellData().end(), r.cellData().begin());
+
+    const Scalar *x = phi.cellData().data();
+    Scalar *y = r.cellData().data();
+
+    detail::addFaceDifferences<FaceDerivative<Order>, 1, 1>(grid, {{x, x, x}}, {{y, y, y}},
+                                                            {{-gamma * dy * dz / dx, -gamma * dx * dz / dy, -gamma * dx * dy / dz}});
+}
+
+template<int Order>
+void gradient(const Field<Scalar> &phi, Field<Vector3D> &result)
+{
+    const StructuredGrid3D &grid = *phi.grid();
+
+    std::fill(result.cellData().begin(), result.cellData().end(), Vector3D(0., 0., 0.));
+
+    const Scalar *x = phi.cellData().data();
+    Scalar *y = &result.cellData().data()->x;
+
+    detail::addFaceDifferences<FaceInterpolation<Order>, 1, 3>(grid, {{x, x, x}}, {{y, y + 1, y + 2}},
+                                                               {{1. / grid.dx(), 1. / grid.dy(), 1. / grid.dz()}});
+}
+
+template<int Order>
+void divergence(const Field<Vector3D> &u, Field<Scalar> &result)
+{
+    const StructuredGrid3D &grid = *u.grid();
+    Scalar dx = grid.dx(), dy = grid.dy(), dz = grid.dz();
+
+    std::fill(result.cellData().begin(), result.cellData().end(), 0.);
+
+    const Scalar *x = &u.cellData().data()->x;
+    Scalar *y = result.cellData().data();
+
+    detail::addFaceDifferences<FaceInterpolation<Order>, 3, 1>(grid, {{x, x + 1, x + 2}}, {{y, y, y}},
+                                                               {{dy * dz, dx * dz, dx * dy}});
+}
+
+}
@@ -1,22 +1,33 @@
 #ifndef PHASE_FINITE_VOLUME_EQUATION_H
 #define PHASE_FINITE_VOLUME_EQUATION_H
 
-#include "Math/Equation.h"
+#include "Math/CrsEquation.h"
 #include "Structured/FiniteVolume/Field/Field.h"
 #include "Math/SparseMatrixSolver.h"
+#include "Math/StructuredStencilOperator.h"
 
+//- Equations are stored in flat CRS arrays with a fixed slot layout, each row holds the cell followed by its
+//- neighbours along each direction out to the stencil radius. The arrays are passed to the sparse solvers directly
 template<class T>
-class FiniteVolumeEquation: public Equation
+class FiniteVolumeEquation: public CrsEquation
 {
 public:
 
-    FiniteVolumeEquation(Field<T> &field);
+    FiniteVolumeEquation(Field<T> &field, int order = 2);
 
-    FiniteVolumeEquation(const std::string &name, Field<T> &field);
+    FiniteVolumeEquation(const std::string &name, Field<T> &field, int order = 2);
 
-    FiniteVolumeEquation(const std::string &name, const Input &input, Field<T> &field);
+    FiniteVolumeEquation(const std::string &name, const Input &input, Field<T> &field, int order = 2);
 
-    FiniteVolumeEquation& operator=(const Equation &rhs);
+    FiniteVolumeEquation(const FiniteVolumeEquation<T> &other) = default;
+
+    FiniteVolumeEquation<T> &operator=(const FiniteVolumeEquation<T> &rhs);
+
+    FiniteVolumeEquation<T> &operator=(FiniteVolumeEquation<T> &&rhs);
+
+    FiniteVolumeEquation<T> &operator=(const CrsEquation &rhs);
+
+    FiniteVolumeEquation<T> &operator=(CrsEquation &&rhs);
 
     void add(const Cell &cell, const Cell &nb, Scalar coeff);
 
@@ -24,15 +35,27 @@ public:
 
     void configureSparseSolver(const Input &input);
 
+    //- Zero the coefficients and sources, the sparsity pattern is kept
+    void clear();
+
     //- Solve
 
     Scalar solve() override;
 
+    //- Solve with a matrix-free operator in place of the assembled coefficients
+    Scalar solve(const StructuredStencilOperator &op);
+
+    bool isMatrixFree() const
+    { return solver_ && solver_->type() == SparseMatrixSolver::GEOMETRIC_MULTIGRID; }
+
 protected:
 
         std::string _name;
 
         Field<T> &_field;
+
+        //- Assembled equations are serial, so the local columns are the global cell ids
+        std::vector<Index> _colGlobalIndices;
 };
 
 #include "FiniteVolumeEquation.tpp"
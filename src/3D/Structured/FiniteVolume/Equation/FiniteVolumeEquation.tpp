@@ -1,29 +1,83 @@
+#include <numeric>
+
 #include "System/Exception.h"
 
 #include "FiniteVolumeEquation.h"
 #include "Math/SparseMatrixSolverFactory.h"
+#include "Math/GeometricMultigridSparseMatrixSolver.h"
+
+template<class T>
+FiniteVolumeEquation<T>::FiniteVolumeEquation(Field<T> &field, int order)
+    :
+      CrsEquation(field.grid()->nCells(), 3 * order + 1),
+      _field(field),
+      _colGlobalIndices(field.grid()->nCells())
+{
+    const StructuredGrid3D &grid = *_field.grid();
+
+    std::iota(_colGlobalIndices.begin(), _colGlobalIndices.end(), 0);
+    Index radius = order / 2;
+    Index n[3] = {(Index) grid.nCellsI(), (Index) grid.nCellsJ(), (Index) grid.nCellsK()};
+
+    //- Neighbours outside of the grid leave their slots empty at the end of the row, where shifted boundary stencils
+    //- can use them
+    for (const Cell &cell: grid.cells())
+    {
+        Index slot = rowPtr_[cell.id()];
+        colInd_[slot++] = cell.id();
+
+        for (int dir = 0; dir < 3; ++dir)
+            for (Index offset = -radius; offset <= radius; ++offset)
+            {
+                Index ijk[3] = {(Index) cell.i(), (Index) cell.j(), (Index) cell.k()};
+                ijk[dir] += offset;
+
+                if (offset != 0 && ijk[dir] >= 0 && ijk[dir] < n[dir])
+                    colInd_[slot++] = grid(ijk[0], ijk[1], ijk[2]).id();
+            }
+    }
+}
 
 template<class T>
-FiniteVolumeEquation<T>::FiniteVolumeEquation(const std::string &name, Field<T> &field)
+FiniteVolumeEquation<T>::FiniteVolumeEquation(const std::string &name, Field<T> &field, int order)
     :
-      FiniteVolumeEquation(field)
+      FiniteVolumeEquation(field, order)
 {
     _name = name;
 }
 
 template<class T>
-FiniteVolumeEquation<T>::FiniteVolumeEquation(const std::string &name, const Input &input, Field<T> &field)
+FiniteVolumeEquation<T>::FiniteVolumeEquation(const std::string &name, const Input &input, Field<T> &field, int order)
     :
-      FiniteVolumeEquation(name, field)
+      FiniteVolumeEquation(name, field, order)
 {
     configureSparseSolver(input);
 }
 
 template<class T>
-FiniteVolumeEquation<T>& FiniteVolumeEquation<T>::operator=(const Equation &rhs)
+FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator=(const FiniteVolumeEquation<T> &rhs)
+{
+    return operator=(static_cast<const CrsEquation&>(rhs));
+}
+
+template<class T>
+FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator=(FiniteVolumeEquation<T> &&rhs)
+{
+    return operator=(static_cast<CrsEquation&&>(rhs));
+}
+
+template<class T>
+FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator=(const CrsEquation &rhs)
+{
+    if (this != &rhs)
+        CrsEquation::operator=(rhs);
+    return *this;
+}
+
+template<class T>
+FiniteVolumeEquation<T> &FiniteVolumeEquation<T>::operator=(CrsEquation &&rhs)
 {
-    coeffs_ = rhs.coeffs();
-    rhs_ = rhs.rhs();
+    CrsEquation::operator=(std::move(rhs));
     return *this;
 }
 
@@ -48,10 +102,42 @@ void FiniteVolumeEquation<T>::configureSparseSolver(const Input &input)
                                  lib.c_str());
 }
 
+template<class T>
+void FiniteVolumeEquation<T>::clear()
+{
+    std::fill(vals_.begin(), vals_.end(), 0.);
+    rhs_.zero();
+}
+
 template<class T>
 Scalar FiniteVolumeEquation<T>::solve()
 {
-    Equation::solve();
+    //- The slot layout keeps the sparsity pattern fixed, so solvers can reuse the matrix structure between solves
+    solver_->setRank(rank());
+    solver_->setLocal(rowPtr_, colInd_, vals_, _colGlobalIndices);
+    solver_->setRhs(-rhs_);
+
+    Scalar error = solver_->solve();
     for (const Cell &cell: _field.grid()->cells())
         _field(cell) = solver_->x(cell.id());
+
+    return error;
+}
+
+template<class T>
+Scalar FiniteVolumeEquation<T>::solve(const StructuredStencilOperator &op)
+{
+    auto solver = std::dynamic_pointer_cast<GeometricMultigridSparseMatrixSolver>(solver_);
+
+    if (!solver)
+        throw Exception("FiniteVolumeEquation<T>", "solve", "equation \"" + _name + "\" does not have a matrix-free solver.");
+
+    solver->setOperator(op);
+    solver->setRhs(-rhs_);
+
+    Scalar error = solver->solve();
+    for (const Cell &cell: _field.grid()->cells())
+        _field(cell) = solver->x(cell.id());
+
+    return error;
 }
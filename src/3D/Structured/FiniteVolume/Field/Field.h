@@ -26,10 +26,10 @@ public:
     { return _name; }
 
     T& operator()(const Cell& cell)
-    { return _cells[cell.id()]; }
+    { return _cells[cell.arrayIndex()]; }
 
     const T& operator()(const Cell& cell) const
-    { return _cells[cell.id()]; }
+    { return _cells[cell.arrayIndex()]; }
 
     T& operator()(const Face& face)
     { return _faces[face.id()]; }
@@ -37,9 +37,19 @@ public:
     const T& operator()(const Face& face) const
     { return _faces[face.id()]; }
 
+    //- Cell values are stored in the padded i, j, k array of the grid decomposition, including ghost cells
+    std::vector<T> &cellData()
+    { return _cells; }
+
     const std::vector<T> &cellData() const
     { return _cells; }
 
+    //- Values of the owned cells in cell id order
+    std::vector<T> ownedCellData() const;
+
+    //- Update the ghost cells from the neighbouring ranks
+    void sendMessages();
+
     //- Bc access
     const std::unique_ptr<BoundaryCondition<T>> &bc(const BoundaryPatch &patch) const;
 
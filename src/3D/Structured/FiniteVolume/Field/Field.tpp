@@ -10,7 +10,7 @@ Field<T>::Field(const std::string &name,
       _grid(grid)
 {
     if(isCellField)
-        _cells.resize(_grid->nCells());
+        _cells.resize(_grid->decomposition()->arraySize());
 
     if(isFaceField)
         _faces.resize(_grid->nFaces());
@@ -34,3 +34,21 @@ const std::unique_ptr<BoundaryCondition<T>> &Field<T>::bc(const BoundaryPatch &p
     auto it = _bcs.find(patch.name());
     return it != _bcs.end() ? it->second: nullptr;
 }
+
+template<class T>
+std::vector<T> Field<T>::ownedCellData() const
+{
+    std::vector<T> vals;
+    vals.reserve(_grid->nCells());
+
+    for(const Cell &cell: _grid->cells())
+        vals.push_back(operator()(cell));
+
+    return vals;
+}
+
+template<class T>
+void Field<T>::sendMessages()
+{
+    _grid->decomposition()->exchange(_cells);
+}
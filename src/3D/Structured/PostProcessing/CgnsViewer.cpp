@@ -66,7 +66,7 @@ void CgnsViewer::write(Scalar time)
 
     for(const auto &field: _solver.lock()->scalarFields())
         if(_scalarFieldNames.find(field.first) != _scalarFieldNames.end())
-            file.writeField(bid, zid, sid, field.first, field.second->cellData());
+            file.writeField(bid, zid, sid, field.first, field.second->ownedCellData());
 
     path = boost::filesystem::path("../../") / ("Proc" + std::to_string(_solver.lock()->grid()->comm().rank())) / "Grid.cgns";
     file.linkNode(bid, zid, "GridCoordinates", path.c_str(), "/Grid/Zone/GridCoordinates");
@@ -1,3 +1,5 @@
+#include "System/Exception.h"
+
 #include "Poisson.h"
 #include "Structured/FiniteVolume/Discretization/Laplacian.h"
 
@@ -12,7 +14,18 @@ Poisson::Poisson(const Input &input, const std::shared_ptr<const StructuredGrid3
 
 Scalar Poisson::solve(Scalar timeStep)
 {
-    _phiEqn = (fv::lap(_gamma, _phi) == 0.);
+    //- Geometric multigrid works directly on the i, j, k arrays, no matrix is assembled
+    if (_phiEqn.isMatrixFree())
+    {
+        _phiEqn.clear();
+        return _phiEqn.solve(fv::lapOperator(_gamma, _phi));
+    }
+
+    //- Assembled equations are built on the local box only
+    if (_grid->comm().nProcs() > 1)
+        throw Exception("Poisson", "solve", "assembled solves are serial, use the multigrid solver in parallel.");
+
+    _phiEqn = fv::lap(_gamma, _phi);
     Scalar error = _phiEqn.solve();
 
     return error;
@@ -7,7 +7,8 @@ Cell::Cell(const StructuredGrid3D &grid, Label i, Label j, Label k)
       _i(i),
       _j(j),
       _k(k),
-      _id(grid.cells().size())
+      _id(grid.cells().size()),
+      _arrayIndex(grid.decomposition()->index(i, j, k))
 {
     _shape = RectangularPrism(grid.node(i, j, k), grid.node(i + 1, j + 1, k + 1));
 }
@@ -30,6 +30,10 @@ public:
     Label id() const
     { return _id; }
 
+    //- Index in the padded cell arrays of fields
+    Label arrayIndex() const
+    { return _arrayIndex; }
+
     const Cell &nb(Index idx, int offset) const;
 
     Scalar volume() const
@@ -56,7 +60,7 @@ protected:
 
     const StructuredGrid3D &_grid;
 
-    Label _i, _j, _k, _id;
+    Label _i, _j, _k, _id, _arrayIndex;
 
     RectangularPrism _shape;
 };
@@ -1,23 +1,32 @@
 #include "StructuredGrid3D.h"
 
-StructuredGrid3D::StructuredGrid3D(Size nCellsI, Size nCellsJ, Size nCellsK, Scalar lx, Scalar ly, Scalar lz)
+StructuredGrid3D::StructuredGrid3D(Size nCellsI, Size nCellsJ, Size nCellsK, Scalar lx, Scalar ly, Scalar lz,
+                                   Size nGhostCells)
     :
-      _nCellsI(nCellsI),
-      _nCellsJ(nCellsJ),
-      _nCellsK(nCellsK),
-      _nCells(nCellsI * nCellsJ * nCellsK),
       _lx(lx),
       _ly(ly),
-      _lz(lz)
+      _lz(lz),
+      _dx(lx / nCellsI),
+      _dy(ly / nCellsJ),
+      _dz(lz / nCellsK)
 {
-    Scalar dx = _lx / _nCellsI;
-    Scalar dy = _ly / _nCellsJ;
-    Scalar dz = _lz / _nCellsK;
+    //- Each rank builds only its own sub-box of the global grid
+    _comm = std::make_shared<Communicator>();
+    _decomp = std::make_shared<CartesianDecomposition>(*_comm, nCellsI, nCellsJ, nCellsK, nGhostCells);
+
+    _nCellsI = _decomp->nLocal(CartesianDecomposition::I);
+    _nCellsJ = _decomp->nLocal(CartesianDecomposition::J);
+    _nCellsK = _decomp->nLocal(CartesianDecomposition::K);
+    _nCells = _nCellsI * _nCellsJ * _nCellsK;
+
+    Scalar x0 = _decomp->begin(CartesianDecomposition::I) * _dx;
+    Scalar y0 = _decomp->begin(CartesianDecomposition::J) * _dy;
+    Scalar z0 = _decomp->begin(CartesianDecomposition::K) * _dz;
 
     for(int k = 0; k < _nCellsK + 1; ++k)
         for(int j = 0; j < _nCellsJ + 1; ++j)
             for(int i = 0; i < _nCellsI + 1; ++i)
-                _nodes.push_back(Point3D(i * dx, j * dy, k * dz));
+                _nodes.push_back(Point3D(x0 + i * _dx, y0 + j * _dy, z0 + k * _dz));
 
     for(int k = 0; k < _nCellsK; ++k)
         for(int j = 0; j < _nCellsJ; ++j)
@@ -41,8 +50,6 @@ StructuredGrid3D::StructuredGrid3D(Size nCellsI, Size nCellsJ, Size nCellsK, Sca
 
                 _kfaces.push_back(Face(*this, Face::K_POS, i, j, k));
             }
-
-    _comm = std::make_shared<Communicator>();
 }
 
 StructuredGrid3D::StructuredGrid3D(const Input &input)
@@ -53,7 +60,8 @@ StructuredGrid3D::StructuredGrid3D(const Input &input)
           input.caseInput().get<Size>("Grid.nCellsZ"),
           input.caseInput().get<Scalar>("Grid.width"),
           input.caseInput().get<Scalar>("Grid.height"),
-          input.caseInput().get<Scalar>("Grid.depth")
+          input.caseInput().get<Scalar>("Grid.depth"),
+          input.caseInput().get<Size>("Grid.nGhostCells", 1)
           )
 {
 
@@ -5,6 +5,7 @@
 
 #include "System/Input.h"
 #include "System/Communicator.h"
+#include "System/CartesianDecomposition.h"
 #include "CellSet.h"
 #include "BoundaryPatch.h"
 
@@ -14,11 +15,12 @@ public:
 
     enum Index{I, J, K};
 
-    StructuredGrid3D(Size nCellsI = 0, Size nCellsJ = 1, Size nCellsK = 1, Scalar lx = 1., Scalar ly = 1., Scalar lz = 1.);
+    StructuredGrid3D(Size nCellsI = 0, Size nCellsJ = 1, Size nCellsK = 1, Scalar lx = 1., Scalar ly = 1., Scalar lz = 1.,
+                     Size nGhostCells = 1);
 
     StructuredGrid3D(const Input &input);
 
-    //- Grid info
+    //- Grid info, the domain lengths and spacings are global while cell counts are those of the local box
     Scalar lx() const
     { return _lx; }
 
@@ -28,6 +30,15 @@ public:
     Scalar lz() const
     { return _lz; }
 
+    Scalar dx() const
+    { return _dx; }
+
+    Scalar dy() const
+    { return _dy; }
+
+    Scalar dz() const
+    { return _dz; }
+
     Size nNodesI() const
     { return _nCellsI + 1; }
 
@@ -90,9 +101,13 @@ public:
     const Communicator& comm() const
     { return *_comm; }
 
+    //- Block decomposition of the global grid, the local box of this rank is the grid
+    const std::shared_ptr<const CartesianDecomposition> &decomposition() const
+    { return _decomp; }
+
 protected:
 
-    Scalar _lx, _ly, _lz;
+    Scalar _lx, _ly, _lz, _dx, _dy, _dz;
 
     Size _nCellsI, _nCellsJ, _nCellsK, _nCells;
 
@@ -104,9 +119,9 @@ protected:
 
     std::vector<Face> _ifaces, _jfaces, _kfaces;
 
-
-
     std::shared_ptr<const Communicator> _comm;
+
+    std::shared_ptr<const CartesianDecomposition> _decomp;
 };
 
 #endif
@@ -0,0 +1,399 @@
+#include <boost/algorithm/string.hpp>
+#include <boost/property_tree/info_parser.hpp>
+
+#include "System/Exception.h"
+#include "System/Timer.h"
+
+#include "AutotuningSparseMatrixSolver.h"
+#include "SparseMatrixSolverFactory.h"
+#include "TrilinosMueluSparseMatrixSolver.h"
+
+AutotuningSparseMatrixSolver::AutotuningSparseMatrixSolver(const Communicator &comm)
+    :
+      comm_(comm)
+{
+
+}
+
+void AutotuningSparseMatrixSolver::setRank(int rank)
+{
+    setRank(rank, rank);
+}
+
+void AutotuningSparseMatrixSolver::setRank(int rowRank, int colRank)
+{
+    //- A new system, switch to the candidate chosen after the last solve
+    if (pending_ >= 0)
+    {
+        active_ = pending_;
+        pending_ = -1;
+    }
+
+    //- Only the winner and its configuration are kept once tuning is over
+    if (!tuning() && candidates_.size() > 1)
+    {
+        candidates_ = {candidates_[winner_]};
+        active_ = winner_ = 0;
+
+        rowPtr_ = colInds_ = colGlobalIndices_ = std::vector<Index>();
+        vals_ = std::vector<Scalar>();
+        rhs_.clear();
+        coordinates_.clear();
+    }
+
+    rowRank_ = rowRank;
+    colRank_ = colRank;
+    replayable_ = true;
+    assemblyTime_ = 0.;
+    x0_.clear();
+
+    solver().setRank(rowRank, colRank);
+}
+
+void AutotuningSparseMatrixSolver::set(const CoefficientList &eqn)
+{
+    Timer timer;
+    timer.start();
+    solver().set(eqn);
+    timer.stop();
+
+    assemblyTime_ += timer.elapsedSeconds();
+    replayable_ = false;
+}
+
+void AutotuningSparseMatrixSolver::set(const std::vector<Index> &rowPtr,
+                                       const std::vector<Index> &colInds,
+                                       const std::vector<Scalar> &vals)
+{
+    Timer timer;
+    timer.start();
+    solver().set(rowPtr, colInds, vals);
+    timer.stop();
+
+    assemblyTime_ += timer.elapsedSeconds();
+
+    if (tuning())
+    {
+        rowPtr_ = rowPtr;
+        colInds_ = colInds;
+        vals_ = vals;
+        local_ = false;
+    }
+}
+
+void AutotuningSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
+{
+    Timer timer;
+    timer.start();
+    solver().set(entries);
+    timer.stop();
+
+    assemblyTime_ += timer.elapsedSeconds();
+    replayable_ = false;
+}
+
+void AutotuningSparseMatrixSolver::setLocal(const std::vector<Index> &rowPtr,
+                                            const std::vector<Index> &localColInds,
+                                            const std::vector<Scalar> &vals,
+                                            const std::vector<Index> &colGlobalIndices)
+{
+    Timer timer;
+    timer.start();
+    solver().setLocal(rowPtr, localColInds, vals, colGlobalIndices);
+    timer.stop();
+
+    assemblyTime_ += timer.elapsedSeconds();
+
+    if (tuning())
+    {
+        rowPtr_ = rowPtr;
+        colInds_ = localColInds;
+        vals_ = vals;
+        colGlobalIndices_ = colGlobalIndices;
+        local_ = true;
+    }
+}
+
+void AutotuningSparseMatrixSolver::setGuess(const Vector &x0)
+{
+    solver().setGuess(x0);
+
+    if (tuning())
+        x0_ = x0;
+}
+
+void AutotuningSparseMatrixSolver::setRhs(const Vector &rhs)
+{
+    solver().setRhs(rhs);
+
+    if (tuning())
+        rhs_ = rhs;
+}
+
+Scalar AutotuningSparseMatrixSolver::solve()
+{
+    if (!tuning())
+        return solver().solve();
+
+    while (true)
+    {
+        Candidate &candidate = candidates_[active_];
+
+        if (candidate.parameters.get<std::string>("lib") == "muelu" && !coordinates_.empty())
+            std::static_pointer_cast<TrilinosMueluSparseMatrixSolver>(candidate.solver)->setCoordinates(coordinates_);
+
+        Timer timer;
+        timer.start();
+
+        bool converged;
+
+        try
+        {
+            candidate.solver->solve();
+            converged = candidate.solver->error() <= tolerance_;
+        }
+        catch (const std::exception &)
+        {
+            converged = false;
+        }
+
+        timer.stop();
+
+        converged = comm_.min((int) converged) == 1;
+        Scalar time = comm_.max(assemblyTime_ + timer.elapsedSeconds());
+
+        if (converged && !recording())
+            return candidate.solver->error();
+
+        if (converged)
+        {
+            candidate.time += time;
+            ++candidate.nSolves;
+
+            comm_.printf("Autotune: candidate %d of %d, \"%s\", solved in %lf s.\n", active_ + 1, (int) candidates_.size(),
+                         candidate.parameters.get<std::string>("lib").c_str(), time);
+
+            if (candidate.nSolves == nTuningSolves_)
+                advance();
+
+            return candidate.solver->error();
+        }
+
+        comm_.printf("Autotune: candidate %d of %d, \"%s\", failed to converge, it will not be used.\n",
+                     active_ + 1, (int) candidates_.size(), candidate.parameters.get<std::string>("lib").c_str());
+
+        candidate.failed = true;
+
+        if (!replayable_)
+            throw Exception("AutotuningSparseMatrixSolver", "solve",
+                            "a candidate failed on a system that cannot be replayed, set the matrix in compressed row form.");
+
+        if (!advance())
+            throw Exception("AutotuningSparseMatrixSolver", "solve", "none of the candidate solvers converged.");
+
+        //- Retry the current system right away
+        active_ = pending_;
+        pending_ = -1;
+        replay();
+    }
+}
+
+Scalar AutotuningSparseMatrixSolver::solveLeastSquares()
+{
+    return solver().solveLeastSquares();
+}
+
+void AutotuningSparseMatrixSolver::setup(const boost::property_tree::ptree &parameters)
+{
+    tolerance_ = parameters.get<Scalar>("tolerance", 1e-8);
+    nTuningSolves_ = parameters.get<int>("autotuneSolves", 2);
+    autotuneFile_ = parameters.get<std::string>("autotuneFile", "autotuned.info");
+
+    candidates_.clear();
+
+    auto candidates = parameters.get_child_optional("candidates");
+
+    if (candidates)
+        for (const auto &candidate: *candidates)
+        {
+            boost::property_tree::ptree candidateParameters = candidate.second;
+
+            //- Candidates solve to the tolerance of the equation
+            candidateParameters.put("tolerance", tolerance_);
+
+            if (!candidateParameters.get_optional<int>("maxIters") && parameters.get_optional<int>("maxIters"))
+                candidateParameters.put("maxIters", parameters.get<int>("maxIters"));
+
+            addCandidate(candidateParameters);
+        }
+    else
+        addDefaultCandidates(parameters);
+
+    if (candidates_.empty())
+        throw Exception("AutotuningSparseMatrixSolver", "setup", "no usable candidate solvers.");
+
+    active_ = 0;
+    pending_ = -1;
+    winner_ = -1;
+
+    comm_.printf("Autotune: timing %d candidate solver configurations over %d solves each.\n",
+                 (int) candidates_.size(), nTuningSolves_);
+}
+
+bool AutotuningSparseMatrixSolver::supportsMPI() const
+{
+    //- Candidates without MPI support are dropped in setup when running in parallel
+    return true;
+}
+
+void AutotuningSparseMatrixSolver::printStatus(const std::string &msg) const
+{
+    solver().printStatus(tuning() || pending_ >= 0 ? msg + " (autotune)" : msg);
+}
+
+void AutotuningSparseMatrixSolver::setCoordinates(const std::vector<Point2D> &coordinates)
+{
+    if (tuning())
+        coordinates_ = coordinates;
+    else if (solver().type() == TRILINOS_MUELU)
+        static_cast<TrilinosMueluSparseMatrixSolver&>(solver()).setCoordinates(coordinates);
+}
+
+//- Private
+
+void AutotuningSparseMatrixSolver::addCandidate(const boost::property_tree::ptree &parameters)
+{
+    std::string lib = parameters.get<std::string>("lib");
+    boost::algorithm::to_lower(lib);
+
+    auto solver = SparseMatrixSolverFactory().create(lib, comm_);
+
+    if (solver->type() == AUTOTUNE || solver->type() == GEOMETRIC_MULTIGRID)
+        throw Exception("AutotuningSparseMatrixSolver", "addCandidate", "lib \"" + lib + "\" cannot be autotuned.");
+
+    if (comm_.nProcs() > 1 && !solver->supportsMPI())
+        return;
+
+    solver->setup(parameters);
+
+    Candidate candidate;
+    candidate.parameters = parameters;
+    candidate.parameters.put("lib", lib);
+    candidate.solver = solver;
+
+    candidates_.push_back(candidate);
+}
+
+void AutotuningSparseMatrixSolver::addDefaultCandidates(const boost::property_tree::ptree &parameters)
+{
+    auto belos = [this, &parameters](const std::string &solver,
+                                     const std::string &innerPreconditioner,
+                                     Scalar iluFill)
+    {
+        boost::property_tree::ptree candidate;
+        candidate.put("lib", "belos");
+        candidate.put("solver", solver);
+        candidate.put("innerPreconditioner", innerPreconditioner);
+        candidate.put("iluFill", iluFill);
+        candidate.put("tolerance", tolerance_);
+        candidate.put("maxIters", parameters.get<int>("maxIters", 500));
+        addCandidate(candidate);
+    };
+
+    //- Krylov methods and smoothers
+    belos("BICGSTAB", "RILUK", 0.);
+    belos("GMRES", "RILUK", 0.);
+    belos("TFQMR", "RILUK", 0.);
+    belos("CG", "RILUK", 0.);
+    belos("BICGSTAB", "RILUK", 1.);
+    belos("GMRES", "ILUT", 1.);
+
+    //- Deflation subspace reused across solves
+    belos("GCRODR", "RILUK", 0.);
+
+    //- Algebraic multigrid, only if its parameter files are given
+    auto belosParamFile = parameters.get_optional<std::string>("belosParamFile");
+    auto mueluParamFile = parameters.get_optional<std::string>("mueluParamFile");
+
+    if (belosParamFile && mueluParamFile)
+        for (const std::string solver: {"GMRES", "CG", "BICGSTAB"})
+        {
+            boost::property_tree::ptree candidate;
+            candidate.put("lib", "muelu");
+            candidate.put("solver", solver);
+            candidate.put("belosParamFile", *belosParamFile);
+            candidate.put("mueluParamFile", *mueluParamFile);
+            candidate.put("tolerance", tolerance_);
+            addCandidate(candidate);
+        }
+
+    //- Direct solvers
+    boost::property_tree::ptree amesos;
+    amesos.put("lib", "amesos2");
+    addCandidate(amesos);
+
+    boost::property_tree::ptree eigen;
+    eigen.put("lib", "eigen");
+    addCandidate(eigen);
+}
+
+void AutotuningSparseMatrixSolver::replay()
+{
+    SparseMatrixSolver &solver = this->solver();
+
+    Timer timer;
+    timer.start();
+
+    solver.setRank(rowRank_, colRank_);
+
+    if (local_)
+        solver.setLocal(rowPtr_, colInds_, vals_, colGlobalIndices_);
+    else
+        solver.set(rowPtr_, colInds_, vals_);
+
+    solver.setRhs(rhs_);
+
+    if (x0_.size() == colRank_)
+        solver.setGuess(x0_);
+
+    timer.stop();
+
+    assemblyTime_ = timer.elapsedSeconds();
+}
+
+bool AutotuningSparseMatrixSolver::advance()
+{
+    for (int i = 1; i <= candidates_.size(); ++i)
+    {
+        int next = (active_ + i) % candidates_.size();
+
+        if (!candidates_[next].failed && candidates_[next].nSolves < nTuningSolves_)
+        {
+            pending_ = next;
+            return true;
+        }
+    }
+
+    //- Every candidate has been timed, lock in the fastest
+    winner_ = -1;
+
+    for (int i = 0; i < candidates_.size(); ++i)
+        if (!candidates_[i].failed && (winner_ < 0 || candidates_[i].time < candidates_[winner_].time))
+            winner_ = i;
+
+    if (winner_ < 0)
+        return false;
+
+    pending_ = winner_;
+
+    const Candidate &winner = candidates_[winner_];
+
+    comm_.printf("Autotune: selected candidate %d, \"%s\", average time %lf s. Configuration written to \"case/%s\".\n",
+                 winner_ + 1, winner.parameters.get<std::string>("lib").c_str(), winner.time / winner.nSolves,
+                 autotuneFile_.c_str());
+
+    if (comm_.isMainProc())
+        boost::property_tree::write_info("case/" + autotuneFile_, winner.parameters);
+
+    return true;
+}
@@ -0,0 +1,127 @@
+#ifndef PHASE_AUTOTUNING_SPARSE_MATRIX_SOLVER_H
+#define PHASE_AUTOTUNING_SPARSE_MATRIX_SOLVER_H
+
+#include <memory>
+
+#include "System/Communicator.h"
+#include "2D/Geometry/Point2D.h"
+
+#include "SparseMatrixSolver.h"
+
+//- Tries a list of candidate solver configurations on the live systems of the first solves, timing the assembly and
+//- solve of each at the required tolerance, then locks in the fastest for the rest of the run. Candidates that fail
+//- to converge are discarded and the system is solved again with the next candidate. The winning configuration is
+//- written to the case directory so it can be pasted into the LinearAlgebra block of later runs.
+class AutotuningSparseMatrixSolver : public SparseMatrixSolver
+{
+public:
+
+    AutotuningSparseMatrixSolver(const Communicator &comm);
+
+    Type type() const override
+    { return AUTOTUNE; }
+
+    void setRank(int rank) override;
+
+    void setRank(int rowRank, int colRank) override;
+
+    void set(const CoefficientList &eqn) override;
+
+    void set(const std::vector<Index> &rowPtr, const std::vector<Index> &colInds, const std::vector<Scalar> &vals) override;
+
+    void set(const std::vector<SparseEntry> &entries) override;
+
+    void setLocal(const std::vector<Index> &rowPtr,
+                  const std::vector<Index> &localColInds,
+                  const std::vector<Scalar> &vals,
+                  const std::vector<Index> &colGlobalIndices) override;
+
+    void setGuess(const Vector &x0) override;
+
+    void setRhs(const Vector &rhs) override;
+
+    Scalar solve() override;
+
+    Scalar solveLeastSquares() override;
+
+    Scalar x(Index idx) const override
+    { return solver().x(idx); }
+
+    void setup(const boost::property_tree::ptree &parameters) override;
+
+    int nIters() const override
+    { return solver().nIters(); }
+
+    Scalar error() const override
+    { return solver().error(); }
+
+    bool supportsMPI() const override;
+
+    void printStatus(const std::string &msg) const override;
+
+    //- Passed on to the algebraic multigrid candidates
+    void setCoordinates(const std::vector<Point2D> &coordinates);
+
+    bool tuning() const
+    { return winner_ < 0; }
+
+private:
+
+    struct Candidate
+    {
+        boost::property_tree::ptree parameters;
+
+        std::shared_ptr<SparseMatrixSolver> solver;
+
+        int nSolves = 0;
+
+        Scalar time = 0.;
+
+        bool failed = false;
+    };
+
+    SparseMatrixSolver &solver()
+    { return *candidates_[active_].solver; }
+
+    const SparseMatrixSolver &solver() const
+    { return *candidates_[active_].solver; }
+
+    void addCandidate(const boost::property_tree::ptree &parameters);
+
+    void addDefaultCandidates(const boost::property_tree::ptree &parameters);
+
+    //- Sets the buffered system on the active candidate
+    void replay();
+
+    //- Moves on to the next candidate that still needs timing, or locks in the winner. Returns false if no candidate
+    //- converged
+    bool advance();
+
+    const Communicator &comm_;
+
+    std::vector<Candidate> candidates_;
+
+    //- Candidate of the current system and the one to switch to with the next system
+    int active_ = 0, pending_ = -1, winner_ = -1, nTuningSolves_ = 2;
+
+    Scalar tolerance_ = 1e-8;
+
+    std::string autotuneFile_;
+
+    //- System of the current solve, buffered while tuning so a failed candidate can be retried
+    int rowRank_ = 0, colRank_ = 0;
+
+    std::vector<Index> rowPtr_, colInds_, colGlobalIndices_;
+
+    std::vector<Scalar> vals_;
+
+    Vector rhs_, x0_;
+
+    bool local_ = false, replayable_ = true;
+
+    std::vector<Point2D> coordinates_;
+
+    Scalar assemblyTime_ = 0.;
+};
+
+#endif
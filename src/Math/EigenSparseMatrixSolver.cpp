@@ -1,3 +1,5 @@
+#include "System/Exception.h"
+
 #include "EigenSparseMatrixSolver.h"
 
 EigenSparseMatrixSolver::EigenSparseMatrixSolver()
@@ -67,12 +69,56 @@ void EigenSparseMatrixSolver::setRhs(const Vector &rhs)
 
 Scalar EigenSparseMatrixSolver::solve()
 {
-    solver_.compute(mat_);
-    x_ = solver_.solve(rhs_);
-    return 0.;
+    if (!mixedPrecision_)
+    {
+        solver_.compute(mat_);
+        x_ = solver_.solve(rhs_);
+        return 0.;
+    }
+
+    matF_ = mat_.cast<float>();
+    solverF_.compute(matF_);
+
+    if (solverF_.info() != Eigen::Success)
+        throw Exception("EigenSparseMatrixSolver", "solve", "single precision factorization failed.");
+
+    //- Each correction is solved in single precision against the double precision residual of the current solution
+    Scalar rhsNorm = rhs_.norm();
+    EigenVector r = rhs_;
+    x_.setZero();
+
+    for (nIters_ = 0;; ++nIters_)
+    {
+        error_ = rhsNorm > 0. ? r.norm() / rhsNorm : 0.;
+
+        if (error_ <= tolerance_ || nIters_ == maxRefinements_)
+            break;
+
+        x_ += solverF_.solve(r.cast<float>()).cast<Scalar>();
+        r = rhs_ - mat_ * x_;
+    }
+
+    return error_;
 }
 
 Scalar EigenSparseMatrixSolver::solve(const Vector &x0)
 {
     return solve();
 }
+
+void EigenSparseMatrixSolver::setup(const boost::property_tree::ptree &parameters)
+{
+    std::string precision = parameters.get<std::string>("precision", "double");
+
+    if (precision == "double")
+        mixedPrecision_ = false;
+    else if (precision == "mixed")
+        mixedPrecision_ = true;
+    else
+        throw Exception("EigenSparseMatrixSolver", "setup", "unrecognized precision \"" + precision + "\".");
+
+    tolerance_ = parameters.get<Scalar>("tolerance", 1e-10);
+    maxRefinements_ = parameters.get<int>("maxRefinements", 20);
+    nIters_ = 1;
+    error_ = 0.;
+}
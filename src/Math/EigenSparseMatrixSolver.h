@@ -16,6 +16,10 @@ public:
     typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> EigenVector;
     typedef Eigen::SparseLU<EigenSparseMatrix> SparseLUSolver;
 
+    //- Single precision factorization used by the mixed precision mode
+    typedef Eigen::SparseMatrix<float> EigenSparseMatrixF;
+    typedef Eigen::SparseLU<EigenSparseMatrixF> SparseLUSolverF;
+
     EigenSparseMatrixSolver();
 
     Type type() const
@@ -42,11 +46,13 @@ public:
     Scalar x(Index idx) const
     { return x_[idx]; }
 
+    void setup(const boost::property_tree::ptree &parameters) override;
+
     int nIters() const
-    { return 1; }
+    { return nIters_; }
 
     Scalar error() const
-    { return 0.; }
+    { return error_; }
 
     bool supportsMPI() const
     { return false; }
@@ -63,6 +69,20 @@ private:
     EigenVector x_, rhs_;
 
     SparseLUSolver solver_;
+
+    //- Mixed precision mode, the matrix is factorized in single precision and the solution is iteratively refined
+    //- using residuals computed in double precision
+    bool mixedPrecision_ = false;
+
+    Scalar tolerance_ = 1e-10;
+
+    int maxRefinements_ = 20, nIters_ = 1;
+
+    Scalar error_ = 0.;
+
+    EigenSparseMatrixF matF_;
+
+    SparseLUSolverF solverF_;
 };
 
 #endif
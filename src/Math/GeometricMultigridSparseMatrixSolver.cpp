@@ -0,0 +1,161 @@
+#include <cmath>
+
+#include "System/Exception.h"
+
+#include "GeometricMultigridSparseMatrixSolver.h"
+
+GeometricMultigridSparseMatrixSolver::GeometricMultigridSparseMatrixSolver()
+{
+
+}
+
+void GeometricMultigridSparseMatrixSolver::setOperator(const StructuredStencilOperator &op)
+{
+    //- Coarsening duplicates communicators and creates new exchange types, so the hierarchy is kept while the fine
+    //- operator is unchanged. All ranks must agree since coarsening is collective
+    bool unchanged = !levels_.empty() && levels_[0].op.sameAs(op);
+
+    if (op.decomposition())
+        unchanged = op.decomposition()->comm().min((int) unchanged) == 1;
+
+    if (unchanged)
+        return;
+
+    //- Keep the current solution as the initial guess if the fine grid is unchanged
+    std::vector<Scalar> x0;
+
+    if (!levels_.empty() && levels_[0].op.arraySize() == op.arraySize())
+        x0 = std::move(levels_[0].x);
+
+    levels_.clear();
+    levels_.push_back(Level{op, {}, {}, {}});
+
+    //- The global size is used so that all ranks stop coarsening at the same level
+    while (levels_.back().op.globalSize() > minCoarseCells_ && levels_.back().op.canCoarsen())
+        levels_.push_back(Level{levels_.back().op.coarsen(), {}, {}, {}});
+
+    for (Level &level: levels_)
+    {
+        level.x.assign(level.op.arraySize(), 0.);
+        level.b.assign(level.op.arraySize(), 0.);
+        level.r.assign(level.op.arraySize(), 0.);
+    }
+
+    if (!x0.empty())
+        levels_[0].x = std::move(x0);
+}
+
+void GeometricMultigridSparseMatrixSolver::setRank(int rank)
+{
+    if (levels_.empty() || levels_[0].op.size() != rank)
+        throw Exception("GeometricMultigridSparseMatrixSolver", "setRank",
+                        "rank does not match the operator, the operator must be set first.");
+}
+
+void GeometricMultigridSparseMatrixSolver::setRank(int rowRank, int colRank)
+{
+    if (rowRank != colRank)
+        throw Exception("GeometricMultigridSparseMatrixSolver", "setRank", "system must be square.");
+
+    setRank(rowRank);
+}
+
+void GeometricMultigridSparseMatrixSolver::set(const CoefficientList &eqn)
+{
+    throw Exception("GeometricMultigridSparseMatrixSolver", "set", "solver is matrix-free, use setOperator.");
+}
+
+void GeometricMultigridSparseMatrixSolver::set(const std::vector<Index> &rowPtr,
+                                               const std::vector<Index> &colInds,
+                                               const std::vector<Scalar> &vals)
+{
+    throw Exception("GeometricMultigridSparseMatrixSolver", "set", "solver is matrix-free, use setOperator.");
+}
+
+void GeometricMultigridSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
+{
+    throw Exception("GeometricMultigridSparseMatrixSolver", "set", "solver is matrix-free, use setOperator.");
+}
+
+void GeometricMultigridSparseMatrixSolver::setGuess(const Vector &x0)
+{
+    Level &fine = levels_[0];
+
+    for (Size n = 0; n < fine.op.size(); ++n)
+        fine.x[fine.op.arrayIndex(n)] = x0(n);
+}
+
+void GeometricMultigridSparseMatrixSolver::setRhs(const Vector &rhs)
+{
+    Level &fine = levels_[0];
+
+    for (Size n = 0; n < fine.op.size(); ++n)
+        fine.b[fine.op.arrayIndex(n)] = rhs(n);
+}
+
+Scalar GeometricMultigridSparseMatrixSolver::solve()
+{
+    if (levels_.empty())
+        throw Exception("GeometricMultigridSparseMatrixSolver", "solve", "no operator has been set.");
+
+    Scalar bNorm = std::sqrt(levels_[0].op.dot(levels_[0].b.data(), levels_[0].b.data()));
+
+    if (bNorm == 0.)
+        bNorm = 1.;
+
+    error_ = residualNorm() / bNorm;
+
+    for (nIters_ = 0; nIters_ < maxIters_ && error_ > tolerance_; ++nIters_)
+    {
+        vCycle(0);
+        error_ = residualNorm() / bNorm;
+    }
+
+    return error_;
+}
+
+void GeometricMultigridSparseMatrixSolver::setup(const boost::property_tree::ptree &parameters)
+{
+    maxIters_ = parameters.get<int>("maxIters", 100);
+    tolerance_ = parameters.get<Scalar>("tolerance", 1e-8);
+    nPreSmooth_ = parameters.get<int>("nPreSmooth", 2);
+    nPostSmooth_ = parameters.get<int>("nPostSmooth", 2);
+    nCoarseSweeps_ = parameters.get<int>("nCoarseSweeps", 50);
+    minCoarseCells_ = parameters.get<Size>("minCoarseCells", 8);
+}
+
+//- Private
+
+void GeometricMultigridSparseMatrixSolver::vCycle(Size levelNo)
+{
+    Level &level = levels_[levelNo];
+
+    if (levelNo + 1 == levels_.size())
+    {
+        level.op.smooth(level.x.data(), level.b.data(), nCoarseSweeps_);
+        return;
+    }
+
+    Level &coarse = levels_[levelNo + 1];
+
+    level.op.smooth(level.x.data(), level.b.data(), nPreSmooth_);
+    level.op.exchange(level.x.data());
+    level.op.residual(level.x.data(), level.b.data(), level.r.data());
+    level.op.restrictTo(coarse.op, level.r.data(), coarse.b.data());
+
+    std::fill(coarse.x.begin(), coarse.x.end(), 0.);
+    vCycle(levelNo + 1);
+    coarse.op.exchange(coarse.x.data());
+
+    level.op.prolongAdd(coarse.op, coarse.x.data(), level.x.data());
+    level.op.smooth(level.x.data(), level.b.data(), nPostSmooth_);
+}
+
+Scalar GeometricMultigridSparseMatrixSolver::residualNorm()
+{
+    Level &fine = levels_[0];
+    fine.op.exchange(fine.x.data());
+    fine.op.residual(fine.x.data(), fine.b.data(), fine.r.data());
+
+    return std::sqrt(fine.op.dot(fine.r.data(), fine.r.data()));
+}
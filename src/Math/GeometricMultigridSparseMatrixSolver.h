@@ -0,0 +1,79 @@
+#ifndef PHASE_GEOMETRIC_MULTIGRID_SPARSE_MATRIX_SOLVER_H
+#define PHASE_GEOMETRIC_MULTIGRID_SPARSE_MATRIX_SOLVER_H
+
+#include "SparseMatrixSolver.h"
+#include "StructuredStencilOperator.h"
+
+//- Matrix-free geometric multigrid for Poisson problems on structured grids. V-cycles with red-black Gauss-Seidel
+//- smoothing, coarsening by 2. The operator is given with setOperator, assembled matrices are not accepted. Operators
+//- built on a CartesianDecomposition are solved in parallel, vectors are indexed by the owned cells of each rank.
+class GeometricMultigridSparseMatrixSolver : public SparseMatrixSolver
+{
+public:
+
+    GeometricMultigridSparseMatrixSolver();
+
+    Type type() const override
+    { return GEOMETRIC_MULTIGRID; }
+
+    void setOperator(const StructuredStencilOperator &op);
+
+    void setRank(int rank) override;
+
+    void setRank(int rowRank, int colRank) override;
+
+    void set(const CoefficientList &eqn) override;
+
+    void set(const std::vector<Index> &rowPtr, const std::vector<Index> &colInds, const std::vector<Scalar> &vals) override;
+
+    void set(const std::vector<SparseEntry> &entries) override;
+
+    void setGuess(const Vector &x0) override;
+
+    void setRhs(const Vector &rhs) override;
+
+    Scalar solve() override;
+
+    Scalar x(Index idx) const override
+    { return levels_[0].x[levels_[0].op.arrayIndex(idx)]; }
+
+    void setup(const boost::property_tree::ptree &parameters) override;
+
+    int nIters() const override
+    { return nIters_; }
+
+    Scalar error() const override
+    { return error_; }
+
+    bool supportsMPI() const override
+    { return true; }
+
+    Size nLevels() const
+    { return levels_.size(); }
+
+private:
+
+    struct Level
+    {
+        StructuredStencilOperator op;
+        std::vector<Scalar> x, b, r;
+    };
+
+    void vCycle(Size levelNo);
+
+    Scalar residualNorm();
+
+    std::vector<Level> levels_;
+
+    int maxIters_ = 100, nPreSmooth_ = 2, nPostSmooth_ = 2, nCoarseSweeps_ = 50;
+
+    Size minCoarseCells_ = 8;
+
+    Scalar tolerance_ = 1e-8;
+
+    int nIters_ = 0;
+
+    Scalar error_ = 0.;
+};
+
+#endif
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "System/Exception.h"
 
 #include "SparseMatrixSolver.h"
@@ -32,6 +34,19 @@ void SparseMatrixSolver::set(const std::vector<std::tuple<Index, Index, Scalar>>
     set(coeffs);
 }
 
+void SparseMatrixSolver::setLocal(const std::vector<Index> &rowPtr,
+                                  const std::vector<Index> &localColInds,
+                                  const std::vector<Scalar> &vals,
+                                  const std::vector<Index> &colGlobalIndices)
+{
+    std::vector<Index> colInds(localColInds.size());
+
+    std::transform(localColInds.begin(), localColInds.end(), colInds.begin(), [&colGlobalIndices](Index col)
+    { return col < 0 ? col : colGlobalIndices[col]; });
+
+    set(rowPtr, colInds, vals);
+}
+
 Scalar SparseMatrixSolver::solve(const Vector &x0)
 {
     setGuess(x0);
@@ -47,3 +62,63 @@ void SparseMatrixSolver::printStatus(const std::string &msg) const
 {
     printf("%s iterations = %d, error = %lf.\n", msg.c_str(), nIters(), error());
 }
+
+void SparseMatrixSolver::setGuessExtrapolationOrder(int order)
+{
+    if (order < 0)
+        throw Exception("SparseMatrixSolver", "setGuessExtrapolationOrder", "extrapolation order must be non-negative.");
+
+    guessExtrapolationOrder_ = order;
+
+    while (solutions_.size() > order)
+        solutions_.pop_back();
+}
+
+void SparseMatrixSolver::setExtrapolatedGuess(Size rank)
+{
+    if (!solutions_.empty() && solutions_.front().size() != rank)
+        solutions_.clear();
+
+    int order = std::min((int) solutions_.size(), guessExtrapolationOrder_);
+
+    if (order == 0)
+        return;
+
+    //- Lagrange extrapolation through equally spaced solutions, x = sum_j (-1)^j C(order, j + 1) x_j
+    Vector x0(rank, 0.);
+    Scalar binom = order;
+
+    for (int j = 0; j < order; ++j)
+    {
+        Scalar coeff = j % 2 == 0 ? binom : -binom;
+
+        for (Index i = 0; i < rank; ++i)
+            x0(i) += coeff * solutions_[j](i);
+
+        binom = binom * (order - j - 1) / (j + 2);
+    }
+
+    setGuess(x0);
+}
+
+void SparseMatrixSolver::storeSolution(Size rank)
+{
+    if (guessExtrapolationOrder_ == 0 || !recording_)
+        return;
+
+    if (solutions_.size() == guessExtrapolationOrder_)
+    {
+        //- Reuse the storage of the oldest solution
+        Vector x = std::move(solutions_.back());
+        solutions_.pop_back();
+        solutions_.push_front(std::move(x));
+    }
+    else
+        solutions_.emplace_front();
+
+    Vector &x = solutions_.front();
+    x.resize(rank);
+
+    for (Index i = 0; i < rank; ++i)
+        x(i) = this->x(i);
+}
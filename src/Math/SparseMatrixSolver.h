@@ -2,6 +2,7 @@
 #define PHASE_SPARSE_MATRIX_SOLVER
 
 #include <tuple>
+#include <deque>
 
 #include <boost/property_tree/ptree.hpp>
 
@@ -14,7 +15,7 @@ public:
 
     enum Type
     {
-        EIGEN, TRILINOS_BELOS, TRILINOS_AMESOS2, TRILINOS_MUELU
+        EIGEN, TRILINOS_BELOS, TRILINOS_AMESOS2, TRILINOS_MUELU, GEOMETRIC_MULTIGRID, AUTOTUNE
     };
 
     typedef std::pair<Index, Scalar> Entry;
@@ -37,6 +38,12 @@ public:
 
     virtual void set(const std::vector<SparseEntry> &entries) = 0;
 
+    //- Set from rows assembled in a local column index space, colGlobalIndices maps each local column to its global index
+    virtual void setLocal(const std::vector<Index> &rowPtr,
+                          const std::vector<Index> &localColInds,
+                          const std::vector<Scalar> &vals,
+                          const std::vector<Index> &colGlobalIndices);
+
     virtual void setGuess(const Vector &x0) = 0;
 
     virtual void setRhs(const Vector &rhs) = 0;
@@ -60,8 +67,40 @@ public:
 
     virtual void printStatus(const std::string &msg) const;
 
+    //- Warm starts, the initial guess is extrapolated from the solutions of the last order solves assuming a
+    //- constant time step. An order of 0 leaves the guess to the solver, 1 reuses the last solution
+    void setGuessExtrapolationOrder(int order);
+
+    int guessExtrapolationOrder() const
+    { return guessExtrapolationOrder_; }
+
+    //- Sets the extrapolated initial guess, stored solutions of a different rank are discarded
+    void setExtrapolatedGuess(Size rank);
+
+    //- Stores the current solution for the guesses of the following solves
+    void storeSolution(Size rank);
+
+    //- Discards the stored solutions, needed when the unknowns are renumbered without changing the rank
+    void clearSolutions()
+    { solutions_.clear(); }
+
+    //- Solves made while recording is off are neither stored for the guesses of later solves nor timed by the
+    //- autotuner, for one-off systems that are not part of the time stepping
+    void setRecording(bool recording)
+    { recording_ = recording; }
+
+    bool recording() const
+    { return recording_; }
+
 protected:
     int nPreconUses_ = 1, maxPreconUses_ = 1;
+
+    int guessExtrapolationOrder_ = 0;
+
+    bool recording_ = true;
+
+    //- Solutions of the previous solves, most recent first
+    std::deque<Vector> solutions_;
 };
 
 #endif
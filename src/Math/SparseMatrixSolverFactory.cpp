@@ -6,6 +6,8 @@
 #include "TrilinosBelosSparseMatrixSolver.h"
 #include "TrilinosAmesosSparseMatrixSolver.h"
 #include "TrilinosMueluSparseMatrixSolver.h"
+#include "GeometricMultigridSparseMatrixSolver.h"
+#include "AutotuningSparseMatrixSolver.h"
 
 std::shared_ptr<SparseMatrixSolver> SparseMatrixSolverFactory::create(Type type, const Communicator &comm) const
 {
@@ -19,6 +21,10 @@ std::shared_ptr<SparseMatrixSolver> SparseMatrixSolverFactory::create(Type type,
             return std::make_shared<TrilinosAmesosSparseMatrixSolver>(comm);
         case TRILINOS_MUELU:
             return std::make_shared<TrilinosMueluSparseMatrixSolver>(comm);
+        case GEOMETRIC_MULTIGRID:
+            return std::make_shared<GeometricMultigridSparseMatrixSolver>();
+        case AUTOTUNE:
+            return std::make_shared<AutotuningSparseMatrixSolver>(comm);
         default:
             return nullptr;
     }
@@ -35,6 +41,10 @@ std::shared_ptr<SparseMatrixSolver> SparseMatrixSolverFactory::create(const std:
         return create(TRILINOS_AMESOS2, comm);
     else if (type == "muelu")
         return create(TRILINOS_MUELU, comm);
+    else if (type == "multigrid" || type == "gmg")
+        return create(GEOMETRIC_MULTIGRID, comm);
+    else if (type == "autotune")
+        return create(AUTOTUNE, comm);
     else
         throw Exception("SparseMatrixSolverFactory", "create", "bad solver type \"" + type + "\".");
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ class SparseMatrixSolverFactory
 {
 public:
 
-    enum Type{EIGEN, TRILINOS_BELOS, TRILINOS_AMESOS2, TRILINOS_MUELU};
+    enum Type{EIGEN, TRILINOS_BELOS, TRILINOS_AMESOS2, TRILINOS_MUELU, GEOMETRIC_MULTIGRID, AUTOTUNE};
 
     std::shared_ptr<SparseMatrixSolver> create(Type type, const Communicator &comm) const;
 
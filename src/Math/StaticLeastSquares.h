@@ -0,0 +1,182 @@
+#ifndef STATIC_LEAST_SQUARES_H
+#define STATIC_LEAST_SQUARES_H
+
+#include <cmath>
+#include <limits>
+#include <initializer_list>
+
+#include "System/Exception.h"
+
+#include "StaticMatrix.h"
+
+//- Householder QR least-squares solver for small overdetermined systems with N unknowns and at most MaxM rows.
+//- All storage is fixed size, so the factorization can live on the stack and be reused for several right hand sides.
+template<int N, int MaxM>
+class StaticLeastSquares
+{
+public:
+
+    StaticLeastSquares()
+    {}
+
+    int m() const
+    { return m_; }
+
+    constexpr int n() const
+    { return N; }
+
+    bool isFactorized() const
+    { return isFactorized_; }
+
+    void clear()
+    {
+        m_ = 0;
+        isFactorized_ = false;
+    }
+
+    void addRow(const std::initializer_list<Scalar> &vals)
+    {
+        if (m_ == MaxM)
+            throw Exception("StaticLeastSquares", "addRow", "maximum number of rows exceeded.");
+
+        std::copy(vals.begin(), vals.begin() + N, A_ + m_++ * N);
+        isFactorized_ = false;
+    }
+
+    //- Returns false if the system is underdetermined or rank deficient, in which case it cannot be solved
+    bool factorize()
+    {
+        isFactorized_ = false;
+
+        if (m_ < N)
+            return false;
+
+        Scalar colNorm[N];
+        for (int j = 0; j < N; ++j)
+        {
+            colNorm[j] = 0.;
+            for (int i = 0; i < m_; ++i)
+                colNorm[j] += a(i, j) * a(i, j);
+
+            colNorm[j] = std::sqrt(colNorm[j]);
+        }
+
+        for (int k = 0; k < N; ++k)
+        {
+            Scalar normSqr = 0.;
+            for (int i = k; i < m_; ++i)
+                normSqr += a(i, k) * a(i, k);
+
+            Scalar norm = std::sqrt(normSqr);
+
+            if (norm == 0. || norm <= tol_ * colNorm[k])
+                return false;
+
+            Scalar alpha = a(k, k) > 0. ? -norm : norm;
+            v0_[k] = a(k, k) - alpha;
+            beta_[k] = 1. / (norm * (norm + std::abs(a(k, k)))); //- 2 / |v|^2
+
+            for (int j = k + 1; j < N; ++j)
+            {
+                Scalar s = v0_[k] * a(k, j);
+                for (int i = k + 1; i < m_; ++i)
+                    s += a(i, k) * a(i, j);
+
+                s *= beta_[k];
+                a(k, j) -= s * v0_[k];
+
+                for (int i = k + 1; i < m_; ++i)
+                    a(i, j) -= s * a(i, k);
+            }
+
+            a(k, k) = alpha;
+        }
+
+        return isFactorized_ = true;
+    }
+
+    //- Least-squares solution of A x = b, where b is a row-major m x K matrix
+    template<int K>
+    StaticMatrix<N, K> solve(const Scalar *b) const
+    {
+        Scalar tmp[MaxM * K];
+        std::copy(b, b + m_ * K, tmp);
+
+        for (int j = 0; j < K; ++j)
+            applyQt(tmp + j, K);
+
+        StaticMatrix<N, K> x;
+
+        for (int j = 0; j < K; ++j)
+            for (int i = N - 1; i >= 0; --i)
+            {
+                Scalar sum = tmp[i * K + j];
+                for (int l = i + 1; l < N; ++l)
+                    sum -= a(i, l) * x(l, j);
+
+                x(i, j) = sum / a(i, i);
+            }
+
+        return x;
+    }
+
+    //- Computes the m interpolation weights w = c^T A^+ for a basis row c
+    void coeffs(const Scalar *c, Scalar *w) const
+    {
+        //- Solve R^T y = c
+        for (int i = 0; i < N; ++i)
+        {
+            Scalar sum = c[i];
+            for (int l = 0; l < i; ++l)
+                sum -= a(l, i) * w[l];
+
+            w[i] = sum / a(i, i);
+        }
+
+        std::fill(w + N, w + m_, 0.);
+
+        //- w = Q [y; 0]
+        for (int k = N - 1; k >= 0; --k)
+            applyReflection(k, w, 1);
+    }
+
+private:
+
+    Scalar &a(int i, int j)
+    { return A_[i * N + j]; }
+
+    Scalar a(int i, int j) const
+    { return A_[i * N + j]; }
+
+    void applyReflection(int k, Scalar *x, int stride) const
+    {
+        Scalar s = v0_[k] * x[k * stride];
+        for (int i = k + 1; i < m_; ++i)
+            s += a(i, k) * x[i * stride];
+
+        s *= beta_[k];
+        x[k * stride] -= s * v0_[k];
+
+        for (int i = k + 1; i < m_; ++i)
+            x[i * stride] -= s * a(i, k);
+    }
+
+    void applyQt(Scalar *x, int stride) const
+    {
+        for (int k = 0; k < N; ++k)
+            applyReflection(k, x, stride);
+    }
+
+    static constexpr Scalar tol_ = 1e3 * std::numeric_limits<Scalar>::epsilon();
+
+    int m_ = 0;
+
+    bool isFactorized_ = false;
+
+    //- Householder vectors are stored below the diagonal, R on and above it
+    Scalar A_[MaxM * N];
+
+    Scalar v0_[N], beta_[N];
+};
+
+#endif
@@ -0,0 +1,346 @@
+#include <algorithm>
+
+#include "System/Exception.h"
+
+#include "StructuredStencilOperator.h"
+
+namespace
+{
+
+//- 1D linear interpolation from a cell-centred coarse line, a ratio of one is a straight copy. Coarse indices are
+//- local and may point into the ghost layers when the line continues on a neighbouring rank
+struct InterpolationWeights
+{
+    Index c0, c1;
+    Scalar w0, w1;
+};
+
+std::vector<InterpolationWeights> interpolationWeights(Size nFine,
+                                                       Size nCoarse,
+                                                       bool hasLower,
+                                                       bool hasUpper,
+                                                       StructuredStencilOperator::BoundaryType lower,
+                                                       StructuredStencilOperator::BoundaryType upper)
+{
+    std::vector<InterpolationWeights> weights(nFine);
+
+    for (Index f = 0; f < nFine; ++f)
+    {
+        if (nFine == nCoarse)
+        {
+            weights[f] = {f, f, 1., 0.};
+            continue;
+        }
+
+        Index c = f / 2;
+        bool lowerSide = f % 2 == 0;
+
+        if (lowerSide && c == 0 && !hasLower)
+            weights[f] = {c, c, lower == StructuredStencilOperator::DIRICHLET ? 0.5 : 1., 0.};
+        else if (!lowerSide && c + 1 == nCoarse && !hasUpper)
+            weights[f] = {c, c, upper == StructuredStencilOperator::DIRICHLET ? 0.5 : 1., 0.};
+        else
+            weights[f] = {c, lowerSide ? c - 1 : c + 1, 0.75, 0.25};
+    }
+
+    return weights;
+}
+
+}
+
+StructuredStencilOperator::StructuredStencilOperator(Size ni, Size nj, Size nk,
+                                                     Scalar dx, Scalar dy, Scalar dz,
+                                                     Scalar gamma)
+    :
+      ni_(ni),
+      nj_(nj),
+      nk_(nk),
+      dx_(dx),
+      dy_(dy),
+      dz_(dz),
+      gamma_(gamma),
+      offset_(0),
+      strideJ_(ni),
+      strideK_(ni * nj),
+      parity_(0)
+{
+    ci_ = gamma_ * dy_ * dz_ / dx_;
+    cj_ = gamma_ * dx_ * dz_ / dy_;
+    ck_ = gamma_ * dx_ * dy_ / dz_;
+
+    bcTypes_.fill(NEUMANN);
+    hasNeighbour_.fill(false);
+}
+
+StructuredStencilOperator::StructuredStencilOperator(const std::shared_ptr<const CartesianDecomposition> &decomp,
+                                                     Scalar dx, Scalar dy, Scalar dz,
+                                                     Scalar gamma)
+    :
+      StructuredStencilOperator(decomp->nLocal(CartesianDecomposition::I),
+                                decomp->nLocal(CartesianDecomposition::J),
+                                decomp->nLocal(CartesianDecomposition::K),
+                                dx, dy, dz, gamma)
+{
+    decomp_ = decomp;
+
+    offset_ = decomp_->index(0, 0, 0);
+    strideJ_ = decomp_->arrayExtent(CartesianDecomposition::I);
+    strideK_ = strideJ_ * decomp_->arrayExtent(CartesianDecomposition::J);
+
+    for (int side = 0; side < 6; ++side)
+        hasNeighbour_[side] = decomp_->hasNeighbour(CartesianDecomposition::Side(side));
+
+    parity_ = (decomp_->begin(CartesianDecomposition::I)
+               + decomp_->begin(CartesianDecomposition::J)
+               + decomp_->begin(CartesianDecomposition::K)) % 2;
+}
+
+Size StructuredStencilOperator::globalSize() const
+{
+    if (!decomp_)
+        return size();
+
+    return decomp_->nGlobal(CartesianDecomposition::I)
+           * decomp_->nGlobal(CartesianDecomposition::J)
+           * decomp_->nGlobal(CartesianDecomposition::K);
+}
+
+bool StructuredStencilOperator::sameAs(const StructuredStencilOperator &other) const
+{
+    return decomp_ == other.decomp_
+            && ni_ == other.ni_ && nj_ == other.nj_ && nk_ == other.nk_
+            && dx_ == other.dx_ && dy_ == other.dy_ && dz_ == other.dz_
+            && gamma_ == other.gamma_
+            && bcTypes_ == other.bcTypes_;
+}
+
+void StructuredStencilOperator::exchange(Scalar *x) const
+{
+    if (decomp_)
+        decomp_->exchange(x);
+}
+
+Scalar StructuredStencilOperator::dot(const Scalar *x, const Scalar *y) const
+{
+    Scalar result = 0.;
+
+#pragma omp parallel for reduction(+:result)
+    for (Index jk = 0; jk < nj_ * nk_; ++jk)
+    {
+        Index j = jk % nj_, k = jk / nj_;
+
+        for (Index i = 0; i < ni_; ++i)
+        {
+            Size c = index(i, j, k);
+            result += x[c] * y[c];
+        }
+    }
+
+    return decomp_ ? decomp_->comm().sum(result) : result;
+}
+
+void StructuredStencilOperator::apply(const Scalar *x, Scalar *y) const
+{
+#pragma omp parallel for
+    for (Index jk = 0; jk < nj_ * nk_; ++jk)
+    {
+        Index j = jk % nj_, k = jk / nj_;
+
+        for (Index i = 0; i < ni_; ++i)
+        {
+            Size c = index(i, j, k);
+            y[c] = neighbourSum(x, i, j, k, c) + diagonal(i, j, k) * x[c];
+        }
+    }
+}
+
+void StructuredStencilOperator::residual(const Scalar *x, const Scalar *b, Scalar *r) const
+{
+#pragma omp parallel for
+    for (Index jk = 0; jk < nj_ * nk_; ++jk)
+    {
+        Index j = jk % nj_, k = jk / nj_;
+
+        for (Index i = 0; i < ni_; ++i)
+        {
+            Size c = index(i, j, k);
+            r[c] = b[c] - neighbourSum(x, i, j, k, c) - diagonal(i, j, k) * x[c];
+        }
+    }
+}
+
+void StructuredStencilOperator::smooth(Scalar *x, const Scalar *b, int nSweeps) const
+{
+    for (int sweep = 0; sweep < nSweeps; ++sweep)
+        for (Size colour = 0; colour < 2; ++colour)
+        {
+            //- The other colour must be current in the ghost layers
+            exchange(x);
+
+#pragma omp parallel for
+            for (Index jk = 0; jk < nj_ * nk_; ++jk)
+            {
+                Index j = jk % nj_, k = jk / nj_;
+
+                for (Index i = (j + k + parity_ + colour) % 2; i < ni_; i += 2)
+                {
+                    Scalar diag = diagonal(i, j, k);
+
+                    //- Only possible for a single cell with no dirichlet boundaries
+                    if (diag == 0.)
+                        continue;
+
+                    Size c = index(i, j, k);
+                    x[c] = (b[c] - neighbourSum(x, i, j, k, c)) / diag;
+                }
+            }
+        }
+}
+
+bool StructuredStencilOperator::canCoarsen() const
+{
+    std::array<Size, 3> ratios = coarseningRatios();
+    return ratios[0] > 1 || ratios[1] > 1 || ratios[2] > 1;
+}
+
+StructuredStencilOperator StructuredStencilOperator::coarsen() const
+{
+    std::array<Size, 3> ratios = coarseningRatios();
+
+    if (ratios[0] == 1 && ratios[1] == 1 && ratios[2] == 1)
+        throw Exception("StructuredStencilOperator", "coarsen", "no direction can be coarsened.");
+
+    Size ri = ratios[0], rj = ratios[1], rk = ratios[2];
+
+    StructuredStencilOperator coarse = decomp_ ?
+                                       StructuredStencilOperator(std::make_shared<const CartesianDecomposition>(*decomp_, ri, rj, rk),
+                                                                 ri * dx_, rj * dy_, rk * dz_, gamma_) :
+                                       StructuredStencilOperator(ni_ / ri, nj_ / rj, nk_ / rk,
+                                                                 ri * dx_, rj * dy_, rk * dz_, gamma_);
+    coarse.bcTypes_ = bcTypes_;
+
+    return coarse;
+}
+
+void StructuredStencilOperator::restrictTo(const StructuredStencilOperator &coarse,
+                                           const Scalar *fine,
+                                           Scalar *coarseVals) const
+{
+    Index ri = ni_ / coarse.ni_, rj = nj_ / coarse.nj_, rk = nk_ / coarse.nk_;
+
+    std::fill(coarseVals, coarseVals + coarse.arraySize(), 0.);
+
+    //- Parallel over coarse planes so that no two threads sum into the same coarse cell. Local boxes are divisible by
+    //- the coarsening ratios, so every coarse cell is restricted on the rank that owns it
+#pragma omp parallel for
+    for (Index kc = 0; kc < coarse.nk_; ++kc)
+        for (Index k = kc * rk; k < (kc + 1) * rk; ++k)
+            for (Index j = 0; j < nj_; ++j)
+                for (Index i = 0; i < ni_; ++i)
+                    coarseVals[coarse.index(i / ri, j / rj, kc)] += fine[index(i, j, k)];
+}
+
+void StructuredStencilOperator::prolongAdd(const StructuredStencilOperator &coarse,
+                                           const Scalar *coarseVals,
+                                           Scalar *fine) const
+{
+    auto wi = interpolationWeights(ni_, coarse.ni_, hasNeighbour_[I_NEG], hasNeighbour_[I_POS],
+                                   bcTypes_[I_NEG], bcTypes_[I_POS]);
+    auto wj = interpolationWeights(nj_, coarse.nj_, hasNeighbour_[J_NEG], hasNeighbour_[J_POS],
+                                   bcTypes_[J_NEG], bcTypes_[J_POS]);
+    auto wk = interpolationWeights(nk_, coarse.nk_, hasNeighbour_[K_NEG], hasNeighbour_[K_POS],
+                                   bcTypes_[K_NEG], bcTypes_[K_POS]);
+
+#pragma omp parallel for
+    for (Index jk = 0; jk < nj_ * nk_; ++jk)
+    {
+        Index j = jk % nj_, k = jk / nj_;
+
+        const InterpolationWeights &w2 = wj[j], &w3 = wk[k];
+
+        for (Index i = 0; i < ni_; ++i)
+        {
+            const InterpolationWeights &w1 = wi[i];
+
+            auto line = [&](Index jc, Index kc)
+            {
+                return w1.w0 * coarseVals[coarse.index(w1.c0, jc, kc)]
+                        + w1.w1 * coarseVals[coarse.index(w1.c1, jc, kc)];
+            };
+
+            auto plane = [&](Index kc)
+            {
+                return w2.w0 * line(w2.c0, kc) + w2.w1 * line(w2.c1, kc);
+            };
+
+            fine[index(i, j, k)] += w3.w0 * plane(w3.c0) + w3.w1 * plane(w3.c1);
+        }
+    }
+}
+
+//- Private
+
+std::array<Size, 3> StructuredStencilOperator::coarseningRatios() const
+{
+    std::array<Size, 3> ratios;
+
+    if (!decomp_)
+    {
+        auto ratio = [](Size n) -> Size { return n > 1 && n % 2 == 0 ? 2 : 1; };
+        ratios = {{ratio(ni_), ratio(nj_), ratio(nk_)}};
+        return ratios;
+    }
+
+    //- A direction is coarsened only if every local box can be halved, so all ranks build the same hierarchy
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        auto d = CartesianDecomposition::Direction(dir);
+
+        int coarsens = decomp_->nGlobal(d) > 1
+                       && decomp_->begin(d) % 2 == 0
+                       && decomp_->end(d) % 2 == 0
+                       && decomp_->nLocal(d) >= 2 * decomp_->nGhost();
+
+        ratios[dir] = decomp_->comm().min(coarsens) ? 2 : 1;
+    }
+
+    return ratios;
+}
+
+Scalar StructuredStencilOperator::diagonal(Index i, Index j, Index k) const
+{
+    //- Dirichlet boundaries are a half cell away from the cell centre
+    auto boundaryCoeff = [this](Side side, Scalar coeff) { return bcTypes_[side] == DIRICHLET ? 2. * coeff : 0.; };
+
+    return -(i > 0 || hasNeighbour_[I_NEG] ? ci_ : boundaryCoeff(I_NEG, ci_))
+            - (i + 1 < ni_ || hasNeighbour_[I_POS] ? ci_ : boundaryCoeff(I_POS, ci_))
+            - (j > 0 || hasNeighbour_[J_NEG] ? cj_ : boundaryCoeff(J_NEG, cj_))
+            - (j + 1 < nj_ || hasNeighbour_[J_POS] ? cj_ : boundaryCoeff(J_POS, cj_))
+            - (k > 0 || hasNeighbour_[K_NEG] ? ck_ : boundaryCoeff(K_NEG, ck_))
+            - (k + 1 < nk_ || hasNeighbour_[K_POS] ? ck_ : boundaryCoeff(K_POS, ck_));
+}
+
+Scalar StructuredStencilOperator::neighbourSum(const Scalar *x, Index i, Index j, Index k, Size c) const
+{
+    Scalar sum = 0.;
+
+    if (i > 0 || hasNeighbour_[I_NEG])
+        sum += ci_ * x[c - 1];
+
+    if (i + 1 < ni_ || hasNeighbour_[I_POS])
+        sum += ci_ * x[c + 1];
+
+    if (j > 0 || hasNeighbour_[J_NEG])
+        sum += cj_ * x[c - strideJ_];
+
+    if (j + 1 < nj_ || hasNeighbour_[J_POS])
+        sum += cj_ * x[c + strideJ_];
+
+    if (k > 0 || hasNeighbour_[K_NEG])
+        sum += ck_ * x[c - strideK_];
+
+    if (k + 1 < nk_ || hasNeighbour_[K_POS])
+        sum += ck_ * x[c + strideK_];
+
+    return sum;
+}
@@ -0,0 +1,132 @@
+#ifndef PHASE_STRUCTURED_STENCIL_OPERATOR_H
+#define PHASE_STRUCTURED_STENCIL_OPERATOR_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "System/CartesianDecomposition.h"
+
+//- Matrix-free finite volume Laplacian on a uniform, logically Cartesian block of cells. Cell (i, j, k) is stored at
+//- (k * nj + j) * ni + i, the same ordering as the structured grids. With nk = 1 the 7-point stencil reduces to the
+//- 5-point stencil. Coefficients are face integrated, so A x = b is solved for a volume integrated source b.
+//- When constructed from a CartesianDecomposition the block is the local box of this rank, and arrays are the padded
+//- arrays of the decomposition, whose ghost layers must be current before apply and residual.
+class StructuredStencilOperator
+{
+public:
+
+    enum BoundaryType
+    {
+        DIRICHLET, NEUMANN
+    };
+
+    enum Side
+    {
+        I_NEG, I_POS, J_NEG, J_POS, K_NEG, K_POS
+    };
+
+    StructuredStencilOperator(Size ni = 0, Size nj = 1, Size nk = 1,
+                              Scalar dx = 1., Scalar dy = 1., Scalar dz = 1.,
+                              Scalar gamma = 1.);
+
+    StructuredStencilOperator(const std::shared_ptr<const CartesianDecomposition> &decomp,
+                              Scalar dx, Scalar dy, Scalar dz,
+                              Scalar gamma = 1.);
+
+    Size ni() const
+    { return ni_; }
+
+    Size nj() const
+    { return nj_; }
+
+    Size nk() const
+    { return nk_; }
+
+    //- Number of owned cells
+    Size size() const
+    { return ni_ * nj_ * nk_; }
+
+    //- Number of cells over all ranks
+    Size globalSize() const;
+
+    //- Length of the arrays the operator works on, including ghost layers
+    Size arraySize() const
+    { return decomp_ ? decomp_->arraySize() : size(); }
+
+    Size index(Index i, Index j, Index k) const
+    { return offset_ + k * strideK_ + j * strideJ_ + i; }
+
+    //- Array index of the n-th owned cell
+    Size arrayIndex(Size n) const
+    { return index(n % ni_, n / ni_ % nj_, n / (ni_ * nj_)); }
+
+    const std::shared_ptr<const CartesianDecomposition> &decomposition() const
+    { return decomp_; }
+
+    //- Boundary types, homogeneous values are assumed (non-zero boundary values belong in the source). Sides shared
+    //- with another rank are not boundaries
+    void setBoundaryType(Side side, BoundaryType type)
+    { bcTypes_[side] = type; }
+
+    BoundaryType boundaryType(Side side) const
+    { return bcTypes_[side]; }
+
+    //- True if both operators work on the same arrays with the same spacing, coefficient and boundary types
+    bool sameAs(const StructuredStencilOperator &other) const;
+
+    //- Update the ghost layers of an array
+    void exchange(Scalar *x) const;
+
+    //- Global dot product over the owned cells
+    Scalar dot(const Scalar *x, const Scalar *y) const;
+
+    //- y = A x
+    void apply(const Scalar *x, Scalar *y) const;
+
+    //- r = b - A x
+    void residual(const Scalar *x, const Scalar *b, Scalar *r) const;
+
+    //- Red-black Gauss-Seidel sweeps, each colour is updated in parallel and its ghost layers exchanged
+    void smooth(Scalar *x, const Scalar *b, int nSweeps) const;
+
+    //- Coarsening halves every direction with an even number of cells greater than one (on all ranks)
+    bool canCoarsen() const;
+
+    StructuredStencilOperator coarsen() const;
+
+    //- Sums the fine cell residuals into the enclosing coarse cells
+    void restrictTo(const StructuredStencilOperator &coarse, const Scalar *fine, Scalar *coarseVals) const;
+
+    //- Adds the linearly interpolated coarse correction to the fine cells, the coarse ghost layers must be current
+    void prolongAdd(const StructuredStencilOperator &coarse, const Scalar *coarseVals, Scalar *fine) const;
+
+private:
+
+    std::array<Size, 3> coarseningRatios() const;
+
+    Scalar diagonal(Index i, Index j, Index k) const;
+
+    Scalar neighbourSum(const Scalar *x, Index i, Index j, Index k, Size c) const;
+
+    Size ni_, nj_, nk_;
+
+    Scalar dx_, dy_, dz_, gamma_;
+
+    //- Face coefficients in each direction
+    Scalar ci_, cj_, ck_;
+
+    std::array<BoundaryType, 6> bcTypes_;
+
+    //- Array layout
+    std::shared_ptr<const CartesianDecomposition> decomp_;
+
+    Index offset_, strideJ_, strideK_;
+
+    std::array<bool, 6> hasNeighbour_;
+
+    //- Parity of the global index of the first owned cell, so that red-black colours agree across ranks
+    Size parity_;
+};
+
+#endif
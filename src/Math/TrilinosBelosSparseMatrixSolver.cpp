@@ -2,6 +2,8 @@
 #include <BelosSolverFactory.hpp>
 #include <Ifpack2_Factory.hpp>
 
+#include "System/Exception.h"
+
 #include "TrilinosBelosSparseMatrixSolver.h"
 
 TrilinosBelosSparseMatrixSolver::TrilinosBelosSparseMatrixSolver(const Communicator &comm)
@@ -13,39 +15,74 @@ TrilinosBelosSparseMatrixSolver::TrilinosBelosSparseMatrixSolver(const Communica
     belosParams_ = rcp(new Teuchos::ParameterList());
     ifpackParams_ = rcp(new Teuchos::ParameterList());
     linearProblem_ = rcp(new LinearProblem());
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+    linearProblemF_ = rcp(new LinearProblemF());
+#endif
 }
 
-void TrilinosBelosSparseMatrixSolver::setRank(int rank)
+Scalar TrilinosBelosSparseMatrixSolver::solve()
 {
     using namespace Teuchos;
     typedef Tpetra::RowMatrix<Scalar, Index, Index> TpetraRowMatrix;
+    typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
 
-    TrilinosSparseMatrixSolver::setRank(rank);
+#ifdef HAVE_TPETRA_INST_FLOAT
+    if (mixedPrecision_)
+        return solveMixedPrecision();
+#endif
 
-    precon_ = Ifpack2::Factory().create(precType_, rcp_static_cast<const TpetraRowMatrix>(mat_));
-    precon_->setParameters(*ifpackParams_);
-    linearProblem_->setOperator(mat_);
-    linearProblem_->setRightPrec(precon_);
-}
+    //- A matrix whose values were replaced in place keeps its symbolic preconditioner setup
+    if (precon_.is_null() || preconMat_ != mat_)
+    {
+        precon_ = Ifpack2::Factory().create(precType_, rcp_static_cast<const TpetraRowMatrix>(mat_));
+        precon_->setParameters(*ifpackParams_);
+        precon_->initialize();
+        preconMat_ = mat_;
+
+        linearProblem_->setOperator(mat_);
+        linearProblem_->setRightPrec(precon_);
+    }
 
-Scalar TrilinosBelosSparseMatrixSolver::solve()
-{
     comm_.printf("Ifpack2: Computing preconditioner...\n");
-    precon_->initialize();
     precon_->compute();
 
+    if (recycledSpaceExpired())
+    {
+        solver_ = SolverFactory().create(solverName_, belosParams_);
+        solver_->setProblem(linearProblem_);
+    }
+
     comm_.printf("Belos: Performing Krylov iterations...\n");
-    linearProblem_->setProblem(x_, b_);
-    solver_->solve();
 
-    return error();
+    if (!refinement_)
+    {
+        linearProblem_->setProblem(x_, b_);
+        solver_->solve();
+        return error();
+    }
+
+    return refine([this](const TpetraMultiVector &r, TpetraMultiVector &d) -> int
+                  {
+                      linearProblem_->setProblem(Teuchos::rcpFromRef(d), Teuchos::rcpFromRef(r));
+                      solver_->solve();
+                      return solver_->getNumIters();
+                  });
 }
 
 void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& parameters)
 {
     typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
 
+    setupRefinement(parameters);
+
+#ifndef HAVE_TPETRA_INST_FLOAT
+    if (mixedPrecision_)
+        throw Exception("TrilinosBelosSparseMatrixSolver", "setup", "mixed precision requires Tpetra to be instantiated for float.");
+#endif
+
     std::string filename = parameters.get<std::string>("belosParamFile", "");
+    solverName_ = parameters.get<std::string>("solver", "BICGSTAB");
 
     if(filename.empty())
     {
@@ -55,9 +92,29 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
     else
         belosParams_ = Teuchos::getParametersFromXmlFile("case/" + filename);
 
-    solver_ = SolverFactory().create(parameters.get<std::string>("solver", "BICGSTAB"), belosParams_);
+    //- With refinement the Krylov solver only has to reduce the residual of each correction by the inner tolerance
+    if (refinement_)
+        belosParams_->set("Convergence Tolerance", innerTolerance_);
+
+    setupRecycling(solverName_, *belosParams_, parameters);
+
+    solver_ = SolverFactory().create(solverName_, belosParams_);
     solver_->setProblem(linearProblem_);
 
+#ifdef HAVE_TPETRA_INST_FLOAT
+    if (mixedPrecision_)
+    {
+        typedef Belos::SolverFactory<float, TpetraMultiVectorF, TpetraOperatorF> SolverFactoryF;
+
+        auto belosParamsF = rcp(new Teuchos::ParameterList(*belosParams_));
+        belosParamsF->set("Convergence Tolerance", (float) innerTolerance_);
+
+        solverF_ = SolverFactoryF().create(solverName_, belosParamsF);
+        solverF_->setProblem(linearProblemF_);
+        matF_ = Teuchos::null;
+    }
+#endif
+
     precType_ = parameters.get<std::string>("preconditioner", "schwarz");
     filename = parameters.get<std::string>("ifpackParamFile", "");
 
@@ -77,19 +134,91 @@ void TrilinosBelosSparseMatrixSolver::setup(const boost::property_tree::ptree& p
     }
     else
         ifpackParams_ = Teuchos::getParametersFromXmlFile("case/" + filename);
+
+    precon_ = Teuchos::null;
 }
 
 int TrilinosBelosSparseMatrixSolver::nIters() const
 {
-    return solver_->getNumIters();
+    return refinement_ ? nInnerIters_ : solver_->getNumIters();
 }
 
 Scalar TrilinosBelosSparseMatrixSolver::error() const
 {
-    return solver_->achievedTol();
+    return refinement_ ? refinementError_ : solver_->achievedTol();
 }
 
 void TrilinosBelosSparseMatrixSolver::printStatus(const std::string &msg) const
 {
-    comm_.printf("%s %s iterations = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), error());
+    if (refinement_)
+        comm_.printf("%s %s iterations = %d, refinements = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), nRefinements_, error());
+    else
+        comm_.printf("%s %s iterations = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), error());
+}
+
+//- Private
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+Scalar TrilinosBelosSparseMatrixSolver::solveMixedPrecision()
+{
+    using namespace Teuchos;
+    typedef Tpetra::RowMatrix<float, Index, Index> TpetraRowMatrixF;
+
+    //- The single precision matrix shares the graph of mat_, so only its values are copied when they are replaced
+    //- in place and the symbolic preconditioner setup is kept
+    bool newGraph = matF_.is_null() || preconMat_ != mat_;
+
+    if (newGraph)
+    {
+        matF_ = rcp(new TpetraCrsMatrixF(mat_->getCrsGraph()));
+        xF_ = rcp(new TpetraMultiVectorF(domainMap_, 1));
+        bF_ = rcp(new TpetraMultiVectorF(rangeMap_, 1));
+        preconMat_ = mat_;
+    }
+    else
+        matF_->resumeFill();
+
+    ArrayView<const Index> cols;
+    ArrayView<const Scalar> vals;
+    std::vector<float> valsF;
+
+    for (Index row = 0, nRows = mat_->getNodeNumRows(); row < nRows; ++row)
+    {
+        mat_->getLocalRowView(row, cols, vals);
+        valsF.assign(vals.begin(), vals.end());
+        matF_->replaceLocalValues(row, cols, arrayViewFromVector(valsF));
+    }
+
+    matF_->fillComplete(domainMap_, rangeMap_);
+
+    if (newGraph)
+    {
+        preconF_ = Ifpack2::Factory().create(precType_, rcp_static_cast<const TpetraRowMatrixF>(matF_));
+        preconF_->setParameters(*ifpackParams_);
+        preconF_->initialize();
+
+        linearProblemF_->setOperator(matF_);
+        linearProblemF_->setRightPrec(preconF_);
+    }
+
+    comm_.printf("Ifpack2: Computing single precision preconditioner...\n");
+    preconF_->compute();
+
+    comm_.printf("Belos: Performing mixed precision Krylov iterations...\n");
+
+    return refine([this](const TpetraMultiVector &r, TpetraMultiVector &d) -> int
+                  {
+                      auto rData = r.getData(0);
+                      std::copy(rData.begin(), rData.end(), bF_->getDataNonConst(0).begin());
+                      xF_->putScalar(0.f);
+
+                      linearProblemF_->setProblem(xF_, bF_);
+                      solverF_->solve();
+
+                      auto dData = xF_->getData(0);
+                      std::copy(dData.begin(), dData.end(), d.getDataNonConst(0).begin());
+
+                      return solverF_->getNumIters();
+                  });
 }
+#endif
@@ -15,8 +15,6 @@ public:
     Type type() const
     { return TRILINOS_BELOS; }
 
-    void setRank(int rank);
-
     Scalar solve();
 
     void setup(const boost::property_tree::ptree &parameters);
@@ -34,7 +32,7 @@ private:
     typedef Ifpack2::Preconditioner<Scalar, Index, Index> Preconditioner;
 
     //- Types
-    std::string precType_;
+    std::string solverName_, precType_;
 
     //- Parameters
     Teuchos::RCP<Teuchos::ParameterList> belosParams_, ifpackParams_;
@@ -43,6 +41,26 @@ private:
     Teuchos::RCP<LinearProblem> linearProblem_;
     Teuchos::RCP<Solver> solver_;
     Teuchos::RCP<Preconditioner> precon_;
+    Teuchos::RCP<TpetraCrsMatrix> preconMat_;
+
+    //- Single precision preconditioner and inner Krylov solver of the mixed precision mode, available when Tpetra is
+    //- instantiated for float
+#ifdef HAVE_TPETRA_INST_FLOAT
+    typedef Tpetra::CrsMatrix<float, Index, Index> TpetraCrsMatrixF;
+    typedef Tpetra::MultiVector<float, Index, Index> TpetraMultiVectorF;
+    typedef Tpetra::Operator<float, Index, Index> TpetraOperatorF;
+    typedef Belos::LinearProblem<float, TpetraMultiVectorF, TpetraOperatorF> LinearProblemF;
+    typedef Belos::SolverManager<float, TpetraMultiVectorF, TpetraOperatorF> SolverF;
+    typedef Ifpack2::Preconditioner<float, Index, Index> PreconditionerF;
+
+    Scalar solveMixedPrecision();
+
+    Teuchos::RCP<LinearProblemF> linearProblemF_;
+    Teuchos::RCP<SolverF> solverF_;
+    Teuchos::RCP<PreconditionerF> preconF_;
+    Teuchos::RCP<TpetraCrsMatrixF> matF_;
+    Teuchos::RCP<TpetraMultiVectorF> xF_, bF_;
+#endif
 };
 
 #endif
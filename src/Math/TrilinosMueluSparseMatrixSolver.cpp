@@ -2,12 +2,15 @@
 #include <MueLu_CreateTpetraPreconditioner.hpp>
 #include <BelosSolverFactory.hpp>
 
+#include "System/Exception.h"
+
 #include "TrilinosMueluSparseMatrixSolver.h"
 
 TrilinosMueluSparseMatrixSolver::TrilinosMueluSparseMatrixSolver(const Communicator &comm,
                                                                  const std::string &solverName)
     :
-      TrilinosSparseMatrixSolver(comm)
+      TrilinosSparseMatrixSolver(comm),
+      solverName_(solverName)
 {
     typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
 
@@ -19,24 +22,38 @@ TrilinosMueluSparseMatrixSolver::TrilinosMueluSparseMatrixSolver(const Communica
     solver_->setProblem(linearProblem_);
 }
 
-void TrilinosMueluSparseMatrixSolver::setRank(int rank)
-{
-    TrilinosSparseMatrixSolver::setRank(rank);
-    linearProblem_->setOperator(mat_);
-}
-
 Scalar TrilinosMueluSparseMatrixSolver::solve()
 {
+    typedef Belos::SolverFactory<Scalar, TpetraMultiVector, TpetraOperator> SolverFactory;
+
     precon_ = MueLu::CreateTpetraPreconditioner(
                 Teuchos::rcp_static_cast<TpetraOperator>(mat_),
                 *mueluParams_,
                 coords_);
 
-    linearProblem_->setProblem(x_, b_);
+    linearProblem_->setOperator(mat_);
     linearProblem_->setLeftPrec(precon_);
-    solver_->solve();
 
-    return error();
+    if (recycledSpaceExpired())
+    {
+        solver_ = SolverFactory().create(solverName_, belosParams_);
+        solver_->setProblem(linearProblem_);
+    }
+
+    if (!refinement_)
+    {
+        linearProblem_->setProblem(x_, b_);
+        solver_->solve();
+        return error();
+    }
+
+    //- The hierarchy is built once and reused by every correction solve
+    return refine([this](const TpetraMultiVector &r, TpetraMultiVector &d) -> int
+                  {
+                      linearProblem_->setProblem(Teuchos::rcpFromRef(d), Teuchos::rcpFromRef(r));
+                      solver_->solve();
+                      return solver_->getNumIters();
+                  });
 }
 
 void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &parameters)
@@ -48,11 +65,24 @@ void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &p
 
     std::string belosParamFile = parameters.get<std::string>("belosParamFile");
     std::string mueluParamFile = parameters.get<std::string>("mueluParamFile");
-    std::string solverName = parameters.get<std::string>("solver", "GMRES");
+    solverName_ = parameters.get<std::string>("solver", "GMRES");
+
+    setupRefinement(parameters);
+
+    //- A single precision hierarchy needs MueLu to be instantiated for float, only double precision refinement is
+    //- supported here
+    if (mixedPrecision_)
+        throw Exception("TrilinosMueluSparseMatrixSolver", "setup", "mixed precision is not supported, use refinement instead.");
 
     belosParams_ = Teuchos::getParametersFromXmlFile("case/" + belosParamFile);
     mueluParams_ = Teuchos::getParametersFromXmlFile("case/" + mueluParamFile);
-    solver_ = SolverFactory().create(solverName, belosParams_);
+
+    if (refinement_)
+        belosParams_->set("Convergence Tolerance", innerTolerance_);
+
+    setupRecycling(solverName_, *belosParams_, parameters);
+
+    solver_ = SolverFactory().create(solverName_, belosParams_);
 
     linearProblem_ = rcp(new LinearProblem());
     solver_->setProblem(linearProblem_);
@@ -60,17 +90,20 @@ void TrilinosMueluSparseMatrixSolver::setup(const boost::property_tree::ptree &p
 
 int TrilinosMueluSparseMatrixSolver::nIters() const
 {
-    return solver_->getNumIters();
+    return refinement_ ? nInnerIters_ : solver_->getNumIters();
 }
 
 Scalar TrilinosMueluSparseMatrixSolver::error() const
 {
-    return solver_->achievedTol();
+    return refinement_ ? refinementError_ : solver_->achievedTol();
 }
 
 void TrilinosMueluSparseMatrixSolver::printStatus(const std::string &msg) const
 {
-    comm_.printf("%s %s iterations = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), error());
+    if (refinement_)
+        comm_.printf("%s %s iterations = %d, refinements = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), nRefinements_, error());
+    else
+        comm_.printf("%s %s iterations = %d, error = %lf.\n", msg.c_str(), "Krylov", nIters(), error());
 }
 
 void TrilinosMueluSparseMatrixSolver::setCoordinates(const std::vector<Point2D> &coordinates)
@@ -20,8 +20,6 @@ public:
     Type type() const
     { return TRILINOS_MUELU; }
 
-    void setRank(int rank);
-
     Scalar solve();
 
     void setup(const boost::property_tree::ptree &parameters);
@@ -42,6 +40,8 @@ private:
     typedef Belos::SolverManager<Scalar, TpetraMultiVector, TpetraOperator> Solver;
     typedef MueLu::TpetraOperator<Scalar, Index, Index> Preconditioner;
 
+    std::string solverName_;
+
     Teuchos::RCP<Teuchos::ParameterList> belosParams_, mueluParams_;
 
     Teuchos::RCP<TpetraMultiVector> coords_;
@@ -51,8 +51,6 @@ private:
     Teuchos::RCP<Solver> solver_;
 
     Teuchos::RCP<Preconditioner> precon_;
-
-
 };
 
 #endif
@@ -1,5 +1,8 @@
+#include <boost/algorithm/string.hpp>
 #include <TpetraExt_MatrixMatrix.hpp>
 
+#include "System/Exception.h"
+
 #include "TrilinosSparseMatrixSolver.h"
 
 TrilinosSparseMatrixSolver::TrilinosSparseMatrixSolver(const Communicator &comm, Tpetra::ProfileType pftype)
@@ -43,16 +46,13 @@ void TrilinosSparseMatrixSolver::setRank(int rowRank, int colRank)
         b_ = rcp(new TpetraMultiVector(rangeMap, 1, true));
         xData_ = x_->getData(0);
     }
-
-    mat_ = rcp(new TpetraCrsMatrix(rangeMap, 20, pftype_));
 }
 
 void TrilinosSparseMatrixSolver::set(const CoefficientList &eqn)
 {
     using namespace Teuchos;
 
-    mat_->resumeFill();
-    mat_->setAllToScalar(0.);
+    mat_ = rcp(new TpetraCrsMatrix(rangeMap_, 20, pftype_));
 
     std::vector<Index> cols; //- profiling shows that these should be outside
     std::vector<Scalar> vals;
@@ -80,8 +80,7 @@ void TrilinosSparseMatrixSolver::set(const std::vector<Index> &rowPtr, const std
 {
     using namespace Teuchos;
 
-    mat_->resumeFill();
-    mat_->setAllToScalar(0.);
+    mat_ = rcp(new TpetraCrsMatrix(rangeMap_, 20, pftype_));
 
     Index minGlobalIndex = mat_->getRowMap()->getMinGlobalIndex();
 
@@ -105,8 +104,7 @@ void TrilinosSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
 {
     using namespace Teuchos;
 
-    mat_->resumeFill();
-    mat_->setAllToScalar(0.);
+    mat_ = rcp(new TpetraCrsMatrix(rangeMap_, 20, pftype_));
 
     Index minGlobalIndex = mat_->getRowMap()->getMinGlobalIndex();
 
@@ -116,6 +114,90 @@ void TrilinosSparseMatrixSolver::set(const std::vector<SparseEntry> &entries)
     mat_->fillComplete(domainMap_, rangeMap_);
 }
 
+void TrilinosSparseMatrixSolver::setLocal(const std::vector<Index> &rowPtr,
+                                          const std::vector<Index> &localColInds,
+                                          const std::vector<Scalar> &vals,
+                                          const std::vector<Index> &colGlobalIndices)
+{
+    using namespace Teuchos;
+
+    //- Only rebuild the column map and importer if the column space or the domain map has changed
+    if (colMap_.is_null() || importer_->getSourceMap() != domainMap_ || colGlobalIndices != colGlobalIndices_)
+    {
+        colGlobalIndices_ = colGlobalIndices;
+        colMap_ = rcp(new TpetraMap(OrdinalTraits<Tpetra::global_size_t>::invalid(),
+                                    ArrayView<const Index>(colGlobalIndices_.data(), colGlobalIndices_.size()),
+                                    0,
+                                    Tcomm_));
+        importer_ = rcp(new TpetraImport(domainMap_, colMap_));
+        patternRowPtr_.clear();
+        patternColInds_.clear();
+    }
+
+    Index nLocalRows = rowPtr.size() - 1;
+
+    //- Same sparsity pattern as the last matrix, so only the values need to be replaced
+    if (!mat_.is_null() && mat_->getColMap() == colMap_ && rowPtr == patternRowPtr_ && localColInds == patternColInds_)
+    {
+        mat_->resumeFill();
+
+        for (Index localRow = 0; localRow < nLocalRows; ++localRow)
+        {
+            Index ibegin = rowPtr[localRow];
+            Index iend = rowPtr[localRow + 1];
+
+            auto rend = localColInds.rend() - ibegin;
+            auto rbeg = localColInds.rend() - iend;
+
+            Size n = rend - std::find_if_not(rbeg, rend, [](Index idx) { return idx < 0; });
+
+            mat_->replaceLocalValues(localRow,
+                                     ArrayView<const Index>(localColInds.data() + ibegin, n),
+                                     ArrayView<const Scalar>(vals.data() + ibegin, n));
+        }
+
+        mat_->fillComplete(domainMap_, rangeMap_);
+        return;
+    }
+
+    patternRowPtr_ = rowPtr;
+    patternColInds_ = localColInds;
+
+    //- New pattern, build the compressed rows with sorted columns and complete the fill with the precomputed importer
+    ArrayRCP<size_t> ptr(nLocalRows + 1, 0);
+
+    for (Index localRow = 0; localRow < nLocalRows; ++localRow)
+        ptr[localRow + 1] = ptr[localRow] + std::count_if(localColInds.begin() + rowPtr[localRow],
+                                                          localColInds.begin() + rowPtr[localRow + 1],
+                                                          [](Index idx) { return idx >= 0; });
+
+    ArrayRCP<Index> ind(ptr[nLocalRows]);
+    ArrayRCP<Scalar> val(ptr[nLocalRows]);
+    std::vector<std::pair<Index, Scalar>> row;
+
+    for (Index localRow = 0; localRow < nLocalRows; ++localRow)
+    {
+        row.clear();
+
+        for (Index j = rowPtr[localRow]; j < rowPtr[localRow + 1]; ++j)
+            if (localColInds[j] >= 0)
+                row.emplace_back(localColInds[j], vals[j]);
+
+        std::sort(row.begin(), row.end(), [](const std::pair<Index, Scalar> &lhs, const std::pair<Index, Scalar> &rhs)
+        { return lhs.first < rhs.first; });
+
+        for (Size k = 0; k < row.size(); ++k)
+        {
+            ind[ptr[localRow] + k] = row[k].first;
+            val[ptr[localRow] + k] = row[k].second;
+        }
+    }
+
+    mat_ = rcp(new TpetraCrsMatrix(rangeMap_, colMap_, 0, pftype_));
+    mat_->setAllValues(ptr, ind, val);
+    mat_->expertStaticFillComplete(domainMap_, rangeMap_, importer_);
+}
+
 void TrilinosSparseMatrixSolver::setGuess(const Vector &x0)
 {
     x_->getDataNonConst(0).assign(std::begin(x0.data()), std::end(x0.data()));
@@ -152,6 +234,86 @@ void TrilinosSparseMatrixSolver::printStatus(const std::string &msg) const
     comm_ << msg << " iterations = " << nIters() << ", error = " << error() << ".\n";
 }
 
+//- Protected
+
+void TrilinosSparseMatrixSolver::setupRefinement(const boost::property_tree::ptree &parameters)
+{
+    std::string precision = parameters.get<std::string>("precision", "double");
+
+    if (precision == "double")
+        mixedPrecision_ = false;
+    else if (precision == "mixed")
+        mixedPrecision_ = true;
+    else
+        throw Exception("TrilinosSparseMatrixSolver", "setupRefinement", "unrecognized precision \"" + precision + "\".");
+
+    refinement_ = mixedPrecision_ || parameters.get<bool>("refinement", false);
+    refinementTolerance_ = parameters.get<Scalar>("tolerance", 1e-8);
+    innerTolerance_ = parameters.get<Scalar>("innerTolerance", 1e-4);
+    maxRefinements_ = parameters.get<int>("maxRefinements", 20);
+}
+
+void TrilinosSparseMatrixSolver::setupRecycling(const std::string &solverName,
+                                                Teuchos::ParameterList &belosParams,
+                                                const boost::property_tree::ptree &parameters)
+{
+    std::string name = boost::algorithm::to_upper_copy(solverName);
+
+    recycling_ = name == "GCRODR" || name == "RECYCLING GMRES" || name == "RCG" || name == "RECYCLING CG";
+    recycleMap_ = Teuchos::null;
+
+    if (!recycling_)
+        return;
+
+    if (mixedPrecision_)
+        throw Exception("TrilinosSparseMatrixSolver", "setupRecycling", "recycling solvers are not supported in mixed precision mode.");
+
+    if (!belosParams.isParameter("Num Recycled Blocks"))
+        belosParams.set("Num Recycled Blocks", parameters.get<int>("recycledBlocks", 20));
+
+    if (!belosParams.isParameter("Num Blocks"))
+        belosParams.set("Num Blocks", parameters.get<int>("krylovSubspaceSize", 50));
+}
+
+bool TrilinosSparseMatrixSolver::recycledSpaceExpired()
+{
+    if (!recycling_ || recycleMap_ == domainMap_)
+        return false;
+
+    recycleMap_ = domainMap_;
+    return true;
+}
+
+Scalar TrilinosSparseMatrixSolver::refine(const std::function<int(const TpetraMultiVector &, TpetraMultiVector &)> &solveCorrection)
+{
+    TpetraMultiVector r(rangeMap_, 1), d(domainMap_, 1);
+    Teuchos::Array<Scalar> norm(1);
+
+    b_->norm2(norm());
+    Scalar rhsNorm = norm[0];
+
+    nInnerIters_ = 0;
+
+    for (nRefinements_ = 0;; ++nRefinements_)
+    {
+        //- r = b - A x
+        mat_->apply(*x_, r);
+        r.update(1., *b_, -1.);
+        r.norm2(norm());
+
+        refinementError_ = rhsNorm > 0. ? norm[0] / rhsNorm : 0.;
+
+        if (refinementError_ <= refinementTolerance_ || nRefinements_ == maxRefinements_)
+            break;
+
+        d.putScalar(0.);
+        nInnerIters_ += solveCorrection(r, d);
+        x_->update(1., d, 1.);
+    }
+
+    return refinementError_;
+}
+
 //- External
 
 std::shared_ptr<TrilinosSparseMatrixSolver> multiply(const TrilinosSparseMatrixSolver &A, const TrilinosSparseMatrixSolver &B, bool transA, bool transB)
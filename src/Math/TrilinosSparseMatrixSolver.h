@@ -1,6 +1,8 @@
 #ifndef TRILINOS_SPARSE_MATRIX_SOLVER_H
 #define TRILINOS_SPARSE_MATRIX_SOLVER_H
 
+#include <functional>
+
 #include <Tpetra_CrsMatrix.hpp>
 
 #include "System/Communicator.h"
@@ -16,6 +18,7 @@ public:
     typedef Tpetra::Operator<Scalar, Index, Index> TpetraOperator;
     typedef Tpetra::CrsMatrix<Scalar, Index, Index> TpetraCrsMatrix;
     typedef Tpetra::MultiVector<Scalar, Index, Index> TpetraMultiVector;
+    typedef Tpetra::Import<Index, Index> TpetraImport;
 
     TrilinosSparseMatrixSolver(const Communicator &comm,
                                Tpetra::ProfileType pftype = Tpetra::StaticProfile);
@@ -32,6 +35,11 @@ public:
 
     virtual void set(const std::vector<SparseEntry> &entries) override;
 
+    virtual void setLocal(const std::vector<Index> &rowPtr,
+                          const std::vector<Index> &localColInds,
+                          const std::vector<Scalar> &vals,
+                          const std::vector<Index> &colGlobalIndices) override;
+
     virtual void setGuess(const Vector &x0);
 
     virtual void setRhs(const Vector &rhs);
@@ -54,6 +62,24 @@ public:
 
 protected:
 
+    //- Reads the precision and refinement parameters shared by the iterative solvers
+    void setupRefinement(const boost::property_tree::ptree &parameters);
+
+    //- Iterative refinement of x_ with residuals computed in double precision. Each correction is an approximate solve
+    //- of A d = r, which may be carried out in a lower precision, returning the number of inner iterations.
+    //- Returns the relative residual of the refined solution
+    Scalar refine(const std::function<int(const TpetraMultiVector &, TpetraMultiVector &)> &solveCorrection);
+
+    //- Recycling Krylov solvers (GCRODR, RCG) keep a deflation subspace between the solves of an equation. Sets the
+    //- subspace size from the parameters unless the Belos parameter list already specifies it
+    void setupRecycling(const std::string &solverName,
+                        Teuchos::ParameterList &belosParams,
+                        const boost::property_tree::ptree &parameters);
+
+    //- The recycled subspace is only valid while the layout of the unknowns is unchanged. Returns true if the
+    //- layout changed since the last call, in which case the Belos solver must be recreated
+    bool recycledSpaceExpired();
+
     const Communicator &comm_;
 
     Teuchos::RCP<const TeuchosComm> Tcomm_;
@@ -66,7 +92,29 @@ protected:
 
     Teuchos::RCP<TpetraCrsMatrix> mat_;
 
+    //- Column map and importer of matrices set in local column indices, kept until the column space changes
+    std::vector<Index> colGlobalIndices_;
+
+    Teuchos::RCP<const TpetraMap> colMap_;
+
+    Teuchos::RCP<const TpetraImport> importer_;
+
+    //- Sparsity pattern of the last matrix set in local column indices
+    std::vector<Index> patternRowPtr_, patternColInds_;
+
     Teuchos::ArrayRCP<const Scalar> xData_;
+
+    //- Iterative refinement, which is always used in mixed precision mode
+    bool mixedPrecision_ = false, refinement_ = false;
+
+    Scalar refinementTolerance_ = 1e-8, innerTolerance_ = 1e-4, refinementError_ = 0.;
+
+    int maxRefinements_ = 20, nRefinements_ = 0, nInnerIters_ = 0;
+
+    //- Krylov subspace recycling
+    bool recycling_ = false;
+
+    Teuchos::RCP<const TpetraMap> recycleMap_;
 };
 
 std::shared_ptr<TrilinosSparseMatrixSolver> multiply(const TrilinosSparseMatrixSolver &A, const TrilinosSparseMatrixSolver &B, bool transA = false, bool transB = false);
@@ -0,0 +1,188 @@
+#include "Exception.h"
+#include "CartesianDecomposition.h"
+
+CartesianDecomposition::CartesianDecomposition(const Communicator &comm,
+                                               Size nCellsI,
+                                               Size nCellsJ,
+                                               Size nCellsK,
+                                               Size nGhost)
+    :
+      nGlobal_({{nCellsI, nCellsJ, nCellsK}}),
+      nGhost_(nGhost)
+{
+    //- MPI numbers the process grid with the last dimension fastest, so dimensions are given in (k, j, i) order to
+    //- number ranks i fastest like the cells. Directions with a single cell are not split
+    int dims[3] = {nCellsK > 1 ? 0 : 1, nCellsJ > 1 ? 0 : 1, nCellsI > 1 ? 0 : 1};
+    int periods[3] = {0, 0, 0};
+
+    MPI_Dims_create(comm.nProcs(), 3, dims);
+
+    //- No reordering, so that ranks are the same as in the parent communicator
+    MPI_Cart_create(comm.communicator(), 3, dims, periods, 0, &cartComm_);
+
+    comm_ = Communicator(cartComm_);
+
+    int coords[3];
+    MPI_Cart_coords(cartComm_, comm_.rank(), 3, coords);
+
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        dims_[dir] = dims[2 - dir];
+        coords_[dir] = coords[2 - dir];
+        MPI_Cart_shift(cartComm_, 2 - dir, 1, &neighbours_[2 * dir], &neighbours_[2 * dir + 1]);
+    }
+
+    partition();
+}
+
+CartesianDecomposition::CartesianDecomposition(const CartesianDecomposition &fine, Size ri, Size rj, Size rk)
+    :
+      nGhost_(fine.nGhost_),
+      dims_(fine.dims_),
+      coords_(fine.coords_),
+      neighbours_(fine.neighbours_)
+{
+    std::array<Size, 3> ratios = {{ri, rj, rk}};
+
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        if (fine.begin_[dir] % ratios[dir] != 0 || fine.end_[dir] % ratios[dir] != 0)
+            throw Exception("CartesianDecomposition", "CartesianDecomposition",
+                            "local box is not divisible by the coarsening ratio.");
+
+        nGlobal_[dir] = fine.nGlobal_[dir] / ratios[dir];
+        begin_[dir] = fine.begin_[dir] / ratios[dir];
+        end_[dir] = fine.end_[dir] / ratios[dir];
+    }
+
+    MPI_Comm_dup(fine.cartComm_, &cartComm_);
+    comm_ = Communicator(cartComm_);
+}
+
+CartesianDecomposition::~CartesianDecomposition()
+{
+    //- Grids may outlive the MPI environment
+    int isFinalized;
+    MPI_Finalized(&isFinalized);
+
+    if (isFinalized)
+        return;
+
+    for (auto &entry: datatypes_)
+        for (MPI_Datatype &type: entry.second)
+            if (type != MPI_DATATYPE_NULL)
+                MPI_Type_free(&type);
+
+    MPI_Comm_free(&cartComm_);
+}
+
+int CartesianDecomposition::owner(Index i, Index j, Index k) const
+{
+    std::array<Index, 3> ijk = {{i, j, k}};
+    int coords[3];
+
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        int offset = ijk[dir] < 0 ? -1 : (ijk[dir] >= (Index) nLocal(Direction(dir)) ? 1 : 0);
+        coords[2 - dir] = coords_[dir] + offset;
+
+        if (coords[2 - dir] < 0 || coords[2 - dir] >= dims_[dir])
+            throw Exception("CartesianDecomposition", "owner", "cell is outside of the global grid.");
+    }
+
+    int rank;
+    MPI_Cart_rank(cartComm_, coords, &rank);
+
+    return rank;
+}
+
+void CartesianDecomposition::exchange(Scalar *data, int nComponents) const
+{
+    const std::array<MPI_Datatype, 12> &types = datatypes(nComponents);
+
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        if (dims_[dir] == 1)
+            continue;
+
+        int lo = 2 * dir, hi = 2 * dir + 1;
+
+        MPI_Request requests[4];
+        int nRequests = 0;
+
+        //- Types 0-5 are the send slabs and 6-11 the ghost slabs of each side
+        for (int side: {lo, hi})
+            if (hasNeighbour(Side(side)))
+            {
+                MPI_Irecv(data, 1, types[6 + side], neighbours_[side], side ^ 1, cartComm_, &requests[nRequests++]);
+                MPI_Isend(data, 1, types[side], neighbours_[side], side, cartComm_, &requests[nRequests++]);
+            }
+
+        MPI_Waitall(nRequests, requests, MPI_STATUSES_IGNORE);
+    }
+}
+
+//- Private
+
+void CartesianDecomposition::partition()
+{
+    for (int dir = 0; dir < 3; ++dir)
+    {
+        Size q = nGlobal_[dir] / dims_[dir];
+        Size r = nGlobal_[dir] % dims_[dir];
+        Size c = coords_[dir];
+
+        begin_[dir] = c * q + std::min(r, c);
+        end_[dir] = begin_[dir] + q + (c < r ? 1 : 0);
+
+        if (dims_[dir] > 1 && end_[dir] - begin_[dir] < nGhost_)
+            throw Exception("CartesianDecomposition", "partition",
+                            "local box is smaller than the number of ghost layers, too many processes for the grid.");
+    }
+}
+
+const std::array<MPI_Datatype, 12> &CartesianDecomposition::datatypes(int nComponents) const
+{
+    auto it = datatypes_.find(nComponents);
+
+    if (it != datatypes_.end())
+        return it->second;
+
+    std::array<MPI_Datatype, 12> &types = datatypes_[nComponents];
+    types.fill(MPI_DATATYPE_NULL);
+
+    MPI_Datatype element;
+    MPI_Type_contiguous(nComponents, MPI_DOUBLE, &element);
+
+    //- Subarrays are specified in C order, (k, j, i)
+    int sizes[3] = {(int) arrayExtent(K), (int) arrayExtent(J), (int) arrayExtent(I)};
+
+    for (int side = 0; side < 6; ++side)
+    {
+        if (!hasNeighbour(Side(side)))
+            continue;
+
+        int dir = side / 2, dim = 2 - dir;
+        bool upper = side % 2 == 1;
+
+        int subsizes[3] = {sizes[0], sizes[1], sizes[2]};
+        subsizes[dim] = nGhost_;
+
+        int sendStarts[3] = {0, 0, 0}, recvStarts[3] = {0, 0, 0};
+
+        Size lower = nGhost(Side(2 * dir));
+        Size n = nLocal(Direction(dir));
+
+        sendStarts[dim] = upper ? lower + n - nGhost_ : lower;
+        recvStarts[dim] = upper ? lower + n : 0;
+
+        MPI_Type_create_subarray(3, sizes, subsizes, sendStarts, MPI_ORDER_C, element, &types[side]);
+        MPI_Type_create_subarray(3, sizes, subsizes, recvStarts, MPI_ORDER_C, element, &types[6 + side]);
+        MPI_Type_commit(&types[side]);
+        MPI_Type_commit(&types[6 + side]);
+    }
+
+    MPI_Type_free(&element);
+
+    return types;
+}
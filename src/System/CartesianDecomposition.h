@@ -0,0 +1,127 @@
+#ifndef PHASE_CARTESIAN_DECOMPOSITION_H
+#define PHASE_CARTESIAN_DECOMPOSITION_H
+
+#include <array>
+#include <map>
+
+#include "Communicator.h"
+
+//- Block decomposition of a logically Cartesian grid over an MPI Cartesian process grid. Each rank owns an i, j, k
+//- sub-box, stored in a local array padded with ghost layers on every side that has a neighbouring rank. Cells are
+//- ordered i fastest, then j, then k, the same as the structured grids. Ghost layers are exchanged with MPI subarray
+//- datatypes, so slabs are sent directly from the array without packing.
+class CartesianDecomposition
+{
+public:
+
+    enum Direction
+    {
+        I, J, K
+    };
+
+    enum Side
+    {
+        I_NEG, I_POS, J_NEG, J_POS, K_NEG, K_POS
+    };
+
+    CartesianDecomposition(const Communicator &comm, Size nCellsI, Size nCellsJ, Size nCellsK = 1, Size nGhost = 1);
+
+    //- Same process grid with every local box coarsened by the given ratios
+    CartesianDecomposition(const CartesianDecomposition &fine, Size ri, Size rj, Size rk);
+
+    CartesianDecomposition(const CartesianDecomposition &) = delete;
+
+    CartesianDecomposition &operator=(const CartesianDecomposition &) = delete;
+
+    ~CartesianDecomposition();
+
+    //- Communicator of the Cartesian process grid, ranks are the same as those of the parent communicator
+    const Communicator &comm() const
+    { return comm_; }
+
+    int dims(Direction dir) const
+    { return dims_[dir]; }
+
+    int coords(Direction dir) const
+    { return coords_[dir]; }
+
+    //- Rank on the given side, MPI_PROC_NULL on a domain boundary
+    int neighbour(Side side) const
+    { return neighbours_[side]; }
+
+    bool hasNeighbour(Side side) const
+    { return neighbours_[side] != MPI_PROC_NULL; }
+
+    //- Global cell counts and the owned range [begin, end) in each direction
+    Size nGlobal(Direction dir) const
+    { return nGlobal_[dir]; }
+
+    Size begin(Direction dir) const
+    { return begin_[dir]; }
+
+    Size end(Direction dir) const
+    { return end_[dir]; }
+
+    Size nLocal(Direction dir) const
+    { return end_[dir] - begin_[dir]; }
+
+    Size nLocalCells() const
+    { return nLocal(I) * nLocal(J) * nLocal(K); }
+
+    Size nGhost() const
+    { return nGhost_; }
+
+    //- Ghost layers below and above the owned box
+    Size nGhost(Side side) const
+    { return hasNeighbour(side) ? nGhost_ : 0; }
+
+    Size arrayExtent(Direction dir) const
+    { return nGhost(Side(2 * dir)) + nLocal(dir) + nGhost(Side(2 * dir + 1)); }
+
+    Size arraySize() const
+    { return arrayExtent(I) * arrayExtent(J) * arrayExtent(K); }
+
+    //- Array index of cell (i, j, k) relative to the owned box, ghost cells have indices outside [0, nLocal)
+    Size index(Index i, Index j, Index k) const
+    {
+        return ((k + (Index) nGhost(K_NEG)) * (Index) arrayExtent(J) + j + (Index) nGhost(J_NEG))
+                * (Index) arrayExtent(I) + i + (Index) nGhost(I_NEG);
+    }
+
+    //- Rank owning cell (i, j, k) relative to the owned box, ghost cells must be within one box of this rank
+    int owner(Index i, Index j, Index k) const;
+
+    //- Exchange all ghost layers with the face neighbours. Directions are exchanged in turn over the full padded
+    //- extent, so edge and corner ghosts are filled as well
+    void exchange(Scalar *data, int nComponents = 1) const;
+
+    template<class T>
+    void exchange(std::vector<T> &data) const
+    {
+        static_assert(sizeof(T) % sizeof(Scalar) == 0, "CartesianDecomposition can only exchange scalar data types.");
+        exchange(reinterpret_cast<Scalar *>(data.data()), sizeof(T) / sizeof(Scalar));
+    }
+
+private:
+
+    void partition();
+
+    //- Subarray datatypes of the send and recv slabs on each side, built on first use for each number of components
+    const std::array<MPI_Datatype, 12> &datatypes(int nComponents) const;
+
+    MPI_Comm cartComm_;
+
+    Communicator comm_;
+
+    std::array<Size, 3> nGlobal_, begin_, end_;
+
+    Size nGhost_;
+
+    std::array<int, 3> dims_, coords_;
+
+    std::array<int, 6> neighbours_;
+
+    mutable std::map<int, std::array<MPI_Datatype, 12>> datatypes_;
+};
+
+#endif
@@ -151,6 +151,20 @@ Tensor3D Communicator::sum(const Tensor3D &val) const
     return result;
 }
 
+std::vector<double> Communicator::sum(const std::vector<double> &vals) const
+{
+    std::vector<double> result(vals);
+    MPI_Allreduce(MPI_IN_PLACE, result.data(), result.size(), MPI_DOUBLE, MPI_SUM, comm_);
+    return result;
+}
+
+std::vector<Vector2D> Communicator::sum(const std::vector<Vector2D> &vals) const
+{
+    std::vector<Vector2D> result(vals);
+    MPI_Allreduce(MPI_IN_PLACE, result.data(), 2 * result.size(), MPI_DOUBLE, MPI_SUM, comm_);
+    return result;
+}
+
 int Communicator::min(int val) const
 {
     int result;
@@ -171,3 +185,15 @@ double Communicator::max(double val) const
     MPI_Allreduce(&val, &result, 1, MPI_DOUBLE, MPI_MAX, comm_);
     return result;
 }
+
+MPI_Request Communicator::imax(std::vector<double> &vals) const
+{
+    MPI_Request request;
+    MPI_Iallreduce(MPI_IN_PLACE, vals.data(), vals.size(), MPI_DOUBLE, MPI_MAX, comm_, &request);
+    return request;
+}
+
+void Communicator::wait(MPI_Request &request) const
+{
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
@@ -161,12 +161,22 @@ public:
 
     Tensor3D sum(const Tensor3D &val) const;
 
+    //- Element-wise sums, one collective for the whole buffer
+    std::vector<double> sum(const std::vector<double> &vals) const;
+
+    std::vector<Vector2D> sum(const std::vector<Vector2D> &vals) const;
+
     int min(int val) const;
 
     double min(double val) const;
 
     double max(double val) const;
 
+    //- Non-blocking collective communications, vals holds the result once the request is complete
+    MPI_Request imax(std::vector<double> &vals) const;
+
+    void wait(MPI_Request &request) const;
+
     //- Additional operators
 
 